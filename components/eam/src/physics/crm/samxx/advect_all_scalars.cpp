@@ -13,11 +13,9 @@ void advect_all_scalars() {
   // advection of scalars :
   advect_scalar(t,dummy,dummy);
 
-  // Advection of microphysics prognostics:
-  for (int k=0; k<nmicro_fields; k++) {
-    if ( k==index_water_vapor || (docloud && flag_precip(k)!=1) || (doprecip && flag_precip(k)==1) ) {
-      advect_scalar(micro_field,k,mkadv,k,mkwle,k);  
-    }
+  // Advection of microphysics prognostics (the list is built in micro_init)
+  if (nmicro_adv>0) {
+    advect_scalar(micro_field,micro_adv,nmicro_adv,mkadv,mkwle);
   }
 
   // Advection of sgs prognostics:
@@ -1,144 +1,88 @@
 #include "advect_scalar.h"
 
-void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
-  YAKL_SCOPE( ncrms  , ::ncrms);
-
-  real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
+// Advect the scalars f(tracers(itr),...), for itr=0,...,ntr-1, all at once (ntr<=nadv_batch).
+// The same entries of fadv and flux are used for each tracer (i.e., fadv(tracers(itr),...)).
+static void advect_scalar_batch(real5d &f, int1d &tracers, int ntr, real3d &fadv, real3d &flux) {
+  YAKL_SCOPE( ncrms          , :: ncrms);
+  YAKL_SCOPE( f0             , :: adv_b_f0);
 
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
   if (docolumn) {
-
-    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      flux(k,icrm) = 0.0;
+    // for (int itr=0; itr<ntr; itr++) {
+    //   for (int k=0; k<nz; k++) {
+    //     for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<3>(ntr,nz,ncrms) , YAKL_LAMBDA (int itr, int k, int icrm) {
+      flux(tracers(itr),k,icrm) = 0.0;
     });
 
   } else {
 
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<dimy_s; j++) {
-    //     for (int i=0; i<dimx_s; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      f0(k,j,i,icrm) = f(k,j,i,icrm);
+    // for (int itr=0; itr<ntr; itr++) {
+    //   for (int k=0; k<nzm; k++) {
+    //     for (int j=0; j<dimy_s; j++) {
+    //       for (int i=0; i<dimx_s; i++) {
+    //         for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<5>(ntr,nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int itr, int k, int j, int i, int icrm) {
+      f0(itr,k,j,i,icrm) = f(tracers(itr),k,j,i,icrm);
     });
 
-    if (RUN3D) {
-      advect_scalar3D(f,flux);
+    if(RUN3D) {
+      advect_scalar3D(f,tracers,ntr,flux);
     } else {
-      advect_scalar2D(f,flux);
+      advect_scalar2D(f,tracers,ntr,flux);
     }
 
-    // for (int k=0; k<nzm; k++) {
-    //  for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      fadv(k,icrm)=0.0;
-    });
-    
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      real tmp = f(k,j+offy_s,i+offx_s,icrm)-f0(k,j+offy_s,i+offx_s,icrm);
-      yakl::atomicAdd(fadv(k,icrm),tmp);
+    // for (int itr=0; itr<ntr; itr++) {
+    //   for (int k=0; k<nzm; k++) {
+    //     for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<3>(ntr,nzm,ncrms) , YAKL_LAMBDA (int itr, int k, int icrm) {
+      fadv(tracers(itr),k,icrm)=0.0;
     });
 
-  }  
-
-}
-
-void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
-  YAKL_SCOPE( ncrms          , :: ncrms);
-
-  real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  if(docolumn) {
-
-    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      flux(k,icrm) = 0.0;
+    // for (int itr=0; itr<ntr; itr++) {
+    //   for (int k=0; k<nzm; k++) {
+    //     for (int j=0; j<ny; j++) {
+    //       for (int i=0; i<nx; i++) {
+    //         for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<5>(ntr,nzm,ny,nx,ncrms) , YAKL_LAMBDA (int itr, int k, int j, int i, int icrm) {
+      int l = tracers(itr);
+      real tmp = f(l,k,j+offy_s,i+offx_s,icrm)-f0(itr,k,j+offy_s,i+offx_s,icrm);
+      yakl::atomicAdd(fadv(l,k,icrm),tmp);
     });
 
-  } else {
-
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<dimy_s; j++) {
-    //     for (int i=0; i<dimx_s; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      f0(k,j,i,icrm) = f(ind_f,k,j,i,icrm);
-    });
+  }
 
-    if(RUN3D) {
-      advect_scalar3D(f,ind_f,flux);
-    } else {
-      advect_scalar2D(f,ind_f,flux);
-    }
+}
 
-    // for (int k=0; k<nzm; k++) {
-    //  for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      fadv(k,icrm)=0.0;
-    });
-    
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      real tmp = f(ind_f,k,j+offy_s,i+offx_s,icrm)-f0(k,j+offy_s,i+offx_s,icrm);
-      yakl::atomicAdd(fadv(k,icrm),tmp);
-    });
+// Advect the scalars f(tracers(itr),...), for itr=0,...,ntr-1. They are advected in
+// batches of at most nadv_batch scalars, which bounds the size of the adv_b_* scratch arrays.
+void advect_scalar(real5d &f, int1d &tracers, int ntr, real3d &fadv, real3d &flux) {
+  for (int itr0=0; itr0<ntr; itr0+=nadv_batch) {
+    int nbatch = min(nadv_batch,ntr-itr0);
+    int1d batch( "batch" , tracers.data()+itr0 , nbatch );
+    advect_scalar_batch(f,batch,nbatch,fadv,flux);
+  }
+}
 
-  }  
+// The single scalar versions below wrap their arguments as a batch of one scalar (f has
+// dims (nzm,dimy_s,dimx_s,ncrms), fadv and flux have dims (nz,ncrms)), and advect it with
+// the same kernels as the batched version above.
+void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
+  real5d f_1   ( "f"    , f.data()    , 1 , nzm , dimy_s , dimx_s , ncrms );
+  real3d fadv_1( "fadv" , fadv.data() , 1 , nz  , ncrms );
+  real3d flux_1( "flux" , flux.data() , 1 , nz  , ncrms );
+  advect_scalar(f_1,adv_single,1,fadv_1,flux_1);
+}
 
+void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
+  real5d f_1   ( "f"    , f.data() + ind_f*nzm*dimy_s*dimx_s*ncrms , 1 , nzm , dimy_s , dimx_s , ncrms );
+  real3d fadv_1( "fadv" , fadv.data()                              , 1 , nz  , ncrms );
+  real3d flux_1( "flux" , flux.data()                              , 1 , nz  , ncrms );
+  advect_scalar(f_1,adv_single,1,fadv_1,flux_1);
 }
 
 void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux) {
-  YAKL_SCOPE( ncrms          , :: ncrms);
-
-  real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  if (docolumn) {
-    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      flux(ind_flux,k,icrm) = 0.0;
-    });
-
-  } else {
-
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<dimy_s; j++) {
-    //     for (int i=0; i<dimx_s; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      f0(k,j,i,icrm) = f(ind_f,k,j,i,icrm);
-    });
-
-    if(RUN3D) {
-      advect_scalar3D(f,ind_f,flux,ind_flux);
-    } else {
-      advect_scalar2D(f,ind_f,flux,ind_flux);
-    }
-
-    // for (int k=0; k<nzm; k++) {
-    //  for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      fadv(ind_fadv,k,icrm)=0.0;
-    });
-    
-    // for (int k=0; k<nzm; k++) {
-    //   for (int j=0; j<ny; j++) {
-    //     for (int i=0; i<nx; i++) {
-    //       for (int icrm=0; icrm<ncrms; icrm++) {
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      real tmp = f(ind_f,k,j+offy_s,i+offx_s,icrm)-f0(k,j+offy_s,i+offx_s,icrm);
-      yakl::atomicAdd(fadv(ind_fadv,k,icrm),tmp);
-    });
-
-  }  
-
+  real5d f_1   ( "f"    , f.data()    + ind_f   *nzm*dimy_s*dimx_s*ncrms , 1 , nzm , dimy_s , dimx_s , ncrms );
+  real3d fadv_1( "fadv" , fadv.data() + ind_fadv*nz*ncrms                , 1 , nz  , ncrms );
+  real3d flux_1( "flux" , flux.data() + ind_flux*nz*ncrms                , 1 , nz  , ncrms );
+  advect_scalar(f_1,adv_single,1,fadv_1,flux_1);
 }
@@ -12,3 +12,5 @@ void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux);
 
 void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux);
 
+void advect_scalar(real5d &f, int1d &tracers, int ntr, real3d &fadv, real3d &flux);
+
@@ -4,11 +4,7 @@
 #include "samxx_const.h"
 #include "vars.h"
 
-void advect_scalar2D(real4d &f, real2d &flux);
-
-void advect_scalar2D(real5d &f, int ind_f, real2d &flux);
-
-void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux);
+void advect_scalar2D(real5d &f, int1d &tracers, int ntr, real3d &flux);
 
 YAKL_INLINE real andiff2(real x1, real x2, real a, real b) {
   return (abs(a)-a*a*b)*0.5*(x2-x1);
@@ -383,5 +383,15 @@ void micro_init() {
     qpsrc(k,icrm) = 0.0;
     qpevp(k,icrm) = 0.0;
   });
+
+  // Fields advected by advect_all_scalars() (all at once)
+  intHost1d micro_adv_host("micro_adv_host",nmicro_fields);
+  nmicro_adv = 0;
+  for (int l=0; l<nmicro_fields; l++) {
+    if ( l==index_water_vapor || (docloud && flag_precip(l)!=1) || (doprecip && flag_precip(l)==1) ) {
+      micro_adv_host(nmicro_adv++) = l;
+    }
+  }
+  micro_adv = micro_adv_host.createDeviceCopy();
 }
 
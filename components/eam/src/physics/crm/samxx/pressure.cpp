@@ -20,10 +20,10 @@ void pressure() {
   int constexpr n3j=3*ny_gl/2+1;
   int constexpr fftySize = ny > 4 ? ny : 4;
 
-  real4d f ("f" , nzslab, ny2, nx2, ncrms);
-  real4d ff("ff", nzm,ny2,nx+1,ncrms);
-  real2d a ("a" , nzm, ncrms);
-  real2d c ("c" , nzm, ncrms);
+  YAKL_SCOPE( f             , :: press_f );
+  YAKL_SCOPE( ff            , :: press_ff );
+  YAKL_SCOPE( a             , :: press_a );
+  YAKL_SCOPE( c             , :: press_c );
 
   int iwall = 0;
   int nypp, jwall;
@@ -35,7 +35,7 @@ void pressure() {
     nypp = ny+2;
   }
 
-  real2d eign("eign",nypp,nx+1);
+  YAKL_SCOPE( eign          , :: press_eign );
 
   press_rhs();
 
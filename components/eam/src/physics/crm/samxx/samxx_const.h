@@ -203,6 +203,7 @@ int  constexpr nsgs_fields = 1;         // total number of prognostic sgs vars
 int  constexpr nsgs_fields_diag = 2;    // total number of diagnostic sgs vars
 bool constexpr do_sgsdiag_bound = true; // exchange boundaries for diagnostics fields
 int  constexpr nmicro_fields = 2;
+int  constexpr nadv_batch = 2;          // max number of scalars advected at once (sizes the adv_b_* scratch)
 int  constexpr index_water_vapor = 0;
 int  constexpr index_cloud_ice = 0;
 
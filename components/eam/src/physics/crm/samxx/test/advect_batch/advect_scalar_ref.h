@@ -0,0 +1,7 @@
+#pragma once
+
+#include "samxx_const.h"
+#include "vars.h"
+
+// Advect f(ind_f,...) with the per-field kernels that predate the batched advect_scalar()
+void ref_advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux);
@@ -12,6 +12,13 @@ make -j8 || exit -1
 ################################################################################
 ################################################################################
 
+printf "\n\nRunning batched advection tests\n\n"
+./advect_batch/advect_batch2d || exit -1
+./advect_batch/advect_batch3d || exit -1
+
+################################################################################
+################################################################################
+
 printf "\n\nRunning 2-D tests\n\n"
 
 printf "\nRunning Fortran code\n\n"
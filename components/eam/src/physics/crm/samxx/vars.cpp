@@ -193,6 +193,30 @@ void allocate() {
   q_vt_pert        = real4d( "q_vt_pert      "     , nzm , ny         , nx     , ncrms ); 
   u_vt_pert        = real4d( "u_vt_pert      "     , nzm , ny         , nx     , ncrms ); 
 
+  // Scratch arrays for pressure and scalar advection (see vars.h)
+  int constexpr nzslab  = nzm/nsubdomains > 1 ? nzm/nsubdomains : 1;
+  int constexpr nypp    = RUN2D ? 1 : ny+2;
+  int constexpr adv_ny2 = RUN3D ? ny+2 : 1;
+  int constexpr adv_ny4 = RUN3D ? ny+4 : 1;
+  press_f          = real4d( "press_f        "  , nzslab , ny+2*YES3D , nx+2   , ncrms );
+  press_ff         = real4d( "press_ff       "  , nzm    , ny+2*YES3D , nx+1   , ncrms );
+  press_a          = real2d( "press_a        "                        , nzm    , ncrms );
+  press_c          = real2d( "press_c        "                        , nzm    , ncrms );
+  press_eign       = real2d( "press_eign     "           , nypp       , nx+1           );
+  adv_iadz         = real2d( "adv_iadz       "                        , nzm    , ncrms );
+  adv_irho         = real2d( "adv_irho       "                        , nzm    , ncrms );
+  adv_irhow        = real2d( "adv_irhow      "                        , nzm    , ncrms );
+  adv_b_f0         = real5d( "adv_b_f0       ", nadv_batch   , nzm , dimy_s , dimx_s , ncrms );
+  adv_b_mx         = real5d( "adv_b_mx       ", nadv_batch   , nzm , adv_ny2, nx+2   , ncrms );
+  adv_b_mn         = real5d( "adv_b_mn       ", nadv_batch   , nzm , adv_ny2, nx+2   , ncrms );
+  adv_b_uuu        = real5d( "adv_b_uuu      ", nadv_batch   , nzm , adv_ny4, nx+5   , ncrms );
+  if (RUN3D) {
+    adv_b_vvv      = real5d( "adv_b_vvv      ", nadv_batch   , nzm , ny+5   , nx+4   , ncrms );
+  }
+  adv_b_www        = real5d( "adv_b_www      ", nadv_batch   , nz  , adv_ny4, nx+4   , ncrms );
+  adv_single       = int1d ( "adv_single     ", 1 );
+  yakl::memset(adv_single,0);
+
   yakl::memset(t00               ,0.);
   yakl::memset(tln               ,0.);
   yakl::memset(qln               ,0.);
@@ -527,6 +551,7 @@ void finalize() {
   qpsrc            = real2d();
   qpevp            = real2d();
   flag_precip      = intHost1d();
+  micro_adv        = int1d();
   fcorz            = real1d(); 
   fcor             = real1d(); 
   longitude0       = real1d(); 
@@ -666,6 +691,21 @@ void finalize() {
   t_vt_pert        = real4d();
   q_vt_pert        = real4d();
   u_vt_pert        = real4d();
+  press_f          = real4d();
+  press_ff         = real4d();
+  press_a          = real2d();
+  press_c          = real2d();
+  press_eign       = real2d();
+  adv_iadz         = real2d();
+  adv_irho         = real2d();
+  adv_irhow        = real2d();
+  adv_b_f0         = real5d();
+  adv_b_mx         = real5d();
+  adv_b_mn         = real5d();
+  adv_b_uuu        = real5d();
+  adv_b_vvv        = real5d();
+  adv_b_www        = real5d();
+  adv_single       = int1d();
 
   yakl::fence();
 
@@ -1627,6 +1667,22 @@ real4d t_vt_pert      ;
 real4d q_vt_pert      ;
 real4d u_vt_pert      ;
 
+real4d press_f        ;
+real4d press_ff       ;
+real2d press_a        ;
+real2d press_c        ;
+real2d press_eign     ;
+real2d adv_iadz       ;
+real2d adv_irho       ;
+real2d adv_irhow      ;
+real5d adv_b_f0       ;
+real5d adv_b_mx       ;
+real5d adv_b_mn       ;
+real5d adv_b_uuu      ;
+real5d adv_b_vvv      ;
+real5d adv_b_www      ;
+int1d  adv_single     ;
+
 real1d fcorz           ;
 real1d fcor            ;
 real1d longitude0      ;
@@ -1666,6 +1722,8 @@ real4d qn              ;
 real2d qpsrc           ;
 real2d qpevp           ;
 intHost1d flag_precip      ;
+int1d micro_adv            ;
+int   nmicro_adv           ;
 int3d flag_top         ;
 
 real4d u_esmt          ;
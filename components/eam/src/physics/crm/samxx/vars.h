@@ -337,6 +337,26 @@ extern real4d t_vt_pert      ;
 extern real4d q_vt_pert      ;
 extern real4d u_vt_pert      ;
 
+// Scratch arrays used by pressure() and advect_scalar/2D/3D(). They are allocated
+// once in allocate() at the start of crm(), and reused across subcycles and tracers,
+// rather than being allocated at every call. Their content is undefined on entry.
+extern real4d press_f        ;
+extern real4d press_ff       ;
+extern real2d press_a        ;
+extern real2d press_c        ;
+extern real2d press_eign     ;
+extern real2d adv_iadz       ;
+extern real2d adv_irho       ;
+extern real2d adv_irhow      ;
+// The leading dim of the adv_b_* arrays is the index in the batch of advected scalars (see nadv_batch)
+extern real5d adv_b_f0       ;
+extern real5d adv_b_mx       ;
+extern real5d adv_b_mn       ;
+extern real5d adv_b_uuu      ;
+extern real5d adv_b_vvv      ;  // Only allocated if RUN3D
+extern real5d adv_b_www      ;
+extern int1d  adv_single     ; // The list of tracers {0}, used to advect a single scalar as a batch of one
+
 extern real1d fcorz           ;
 extern real1d fcor            ;
 extern real1d longitude0      ;
@@ -373,6 +393,8 @@ extern real4d qn              ;
 extern real2d qpsrc           ;
 extern real2d qpevp           ;
 extern intHost1d flag_precip  ;
+extern int1d micro_adv        ; // Indices of the microphysics fields advected by advect_all_scalars() (set in micro_init())
+extern int   nmicro_adv       ; // Number of entries in micro_adv
 extern int3d flag_top         ;
 
 extern real2d u_esmt_sgs      ;
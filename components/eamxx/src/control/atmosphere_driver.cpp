@@ -129,6 +129,12 @@ set_params(const ekat::ParameterList& atm_params)
 
   create_logger ();
 
+  // If requested, record all timer events, so we can export them as a trace
+  const auto& driver_options = m_atm_params.sublist("driver_options");
+  if (driver_options.get("enable_timers_trace",false)) {
+    enable_timers_trace(driver_options.get("timers_trace_max_events",1000000));
+  }
+
   m_ad_status |= s_params_set;
 }
 
@@ -721,9 +727,11 @@ void AtmosphereDriver::initialize_output_managers () {
     checkpoint_params.set("Frequency",restart_pl.sublist("output_control").get<int>("Frequency"));
   }
 
-  // Build one manager per output yaml file
+  // Build one manager per output yaml file. Diagnostics requested by several
+  // managers are shared, so that each is computed at most once per step.
   using vos_t = std::vector<std::string>;
   const auto& output_yaml_files = io_params.get<vos_t>("output_yaml_files",vos_t{});
+  auto diags_registry = std::make_shared<OutputDiagnosticsRegistry>();
   int om_tally = 0;
   for (const auto& fname : output_yaml_files) {
     ekat::ParameterList params;
@@ -742,6 +750,7 @@ void AtmosphereDriver::initialize_output_managers () {
     m_output_managers.emplace_back();
     auto& om = m_output_managers.back();
     om.set_logger(m_atm_logger);
+    om.set_diagnostics_registry(diags_registry);
     om.setup(m_atm_comm,params,m_field_mgrs,m_grids_manager,m_run_t0,m_case_t0,false);
   }
 
@@ -1675,6 +1684,12 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
     it.second->clean_up();
   }
 
+  // Write the timer events trace (if enabled). Each rank writes its own file
+  if (is_timers_trace_enabled()) {
+    const auto prefix = m_atm_params.sublist("driver_options").get<std::string>("timers_trace_prefix","eamxx_timers_trace");
+    write_timers_trace (m_atm_comm,prefix);
+  }
+
   // Write all timers to file, and possibly finalize gptl
   if (not m_gptl_externally_handled) {
     write_timers_to_file (m_atm_comm,"scream_timing.txt");
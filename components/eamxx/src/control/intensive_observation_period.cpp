@@ -42,6 +42,10 @@ void read_dimensionless_variable_from_file(const std::string& filename,
   EKAT_REQUIRE_MSG(scorpio::has_variable(filename,varname),
                    "Error! IOP file does not have variable "+varname+".\n");
 
+  // We call PIO directly, so make sure no I/O task is in flight
+  // (PIO calls are collective, and must be issued in the same order on all ranks)
+  scorpio::wait_for_pending_io_tasks();
+
   int ncid, varid, err1, err2;
   bool was_open = scorpio::is_file_open_c2f(filename.c_str(),-1);
   if (not was_open) {
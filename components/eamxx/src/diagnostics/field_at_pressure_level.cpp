@@ -35,9 +35,6 @@ FieldAtPressureLevel (const ekat::Comm& comm, const ekat::ParameterList& params)
     m_pressure_level *= 100;
   }
 
-  m_p_tgt = view_1d<Pack1>("",1);
-  Kokkos::deep_copy(m_p_tgt, m_pressure_level);
-
   m_mask_val = m_params.get<double>("mask_value",Real(std::numeric_limits<float>::max()/10.0));
 
   m_diag_name = m_field_name + "_at_" + location;
@@ -130,6 +127,9 @@ void FieldAtPressureLevel::compute_diagnostic_impl()
   view_Nd<const Pack1,2> pres(pressure.data(),pressure.extent_int(0),pressure.extent_int(1));
   // Kokkos::deep_copy(pres,pressure);
 
+  // The interpolation plan is shared with all the other diags at the same pressure level
+  const auto plan = get_vertical_interpolation_plan<1>(pressure_f,{m_pressure_level});
+
   const Field& f = get_field_in(m_field_name);
 
   // The setup for interpolation varies depending on the rank of the input field:
@@ -142,26 +142,26 @@ void FieldAtPressureLevel::compute_diagnostic_impl()
     //output field on new grid
     auto d_data_tgt = m_diagnostic_output.get_view<Pack1*>();
     view_Nd<Pack1,2> data_tgt_tmp(d_data_tgt.data(),d_data_tgt.extent_int(0),1);  // Note, vertical interp wants a 2D view, so we create a temporary one
-    perform_vertical_interpolation<Real,1,2>(pres,m_p_tgt,f_data_src,data_tgt_tmp,m_num_levs,1,m_mask_val);
+    perform_vertical_interpolation<Real,1,2>(pres,*plan,f_data_src,data_tgt_tmp,m_mask_val);
 
     // Track mask
     auto mask = m_diagnostic_output.get_header().get_extra_data<Field>("mask_data");
     auto d_mask_tgt = mask.get_view<Pack1*>();
     view_Nd<Pack1,2> mask_tgt_tmp(d_mask_tgt.data(),d_mask_tgt.extent_int(0),1);  
-    perform_vertical_interpolation<Real,1,2>(pres,m_p_tgt,mask_v_tmp,mask_tgt_tmp,m_num_levs,1,0);
+    perform_vertical_interpolation<Real,1,2>(pres,*plan,mask_v_tmp,mask_tgt_tmp,0);
   } else if (rank==3) {
     const auto f_data_src = f.get_view<const Pack1***>();
     //output field on new grid
     auto d_data_tgt = m_diagnostic_output.get_view<Pack1**>();
     view_Nd<Pack1,3> data_tgt_tmp(d_data_tgt.data(),d_data_tgt.extent_int(0),d_data_tgt.extent_int(1),1);  
 
-    perform_vertical_interpolation<Real,1,3>(pres,m_p_tgt,f_data_src,data_tgt_tmp,m_num_levs,1,m_mask_val);
+    perform_vertical_interpolation<Real,1,3>(pres,*plan,f_data_src,data_tgt_tmp,m_mask_val);
 
     // Track mask
     auto mask = m_diagnostic_output.get_header().get_extra_data<Field>("mask_data");
     auto d_mask_tgt = mask.get_view<Pack1*>();
     view_Nd<Pack1,2> mask_tgt_tmp(d_mask_tgt.data(),d_mask_tgt.extent_int(0),1);  
-    perform_vertical_interpolation<Real,1,2>(pres,m_p_tgt,mask_v_tmp,mask_tgt_tmp,m_num_levs,1,0);
+    perform_vertical_interpolation<Real,1,2>(pres,*plan,mask_v_tmp,mask_tgt_tmp,0);
   } else {
     EKAT_ERROR_MSG("Error! field at pressure level only supports fields ranks 2 and 3 \n");
   }
@@ -45,7 +45,6 @@ protected:
   std::string         m_field_name;
   std::string         m_diag_name;
 
-  view_1d<Pack1>      m_p_tgt;
   Field               m_mask_field;
   Real                m_pressure_level;
   int                 m_num_levs;
@@ -3,7 +3,11 @@
 
 #include "p3_functions.hpp" // for ETI only but harmless for GPU
 
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
+#include <string>
+#include <vector>
 
 namespace scream {
 namespace p3 {
@@ -13,21 +17,91 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
+namespace ice_table_impl {
+
+// Header of the binary ice lookup table file. The tables are stored
+// as doubles (with log10 already applied to the collection table),
+// right after the header, in row-major order. The byte order and the
+// size of double are stored, so that a file generated on a different
+// architecture is rejected rather than misread.
+struct BinaryHeader {
+  char          magic[8];
+  std::int32_t  format_version;
+  std::uint32_t byte_order;
+  std::int32_t  double_size;
+  char          p3_version[16];
+  std::int32_t  dims[6];
+};
+
+constexpr char bin_magic[8] = {'P','3','I','C','E','T','A','B'};
+constexpr std::int32_t  bin_format_version = 2;
+constexpr std::uint32_t bin_byte_order = 0x01020304;
+
+} // namespace ice_table_impl
+
 template <typename S, typename D>
 void Functions<S,D>
-::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+::read_ice_lookup_tables(std::vector<double>& ice_table, std::vector<double>& collect_table)
+{
+  // Try the binary table first. If it is missing or not usable (e.g., generated by
+  // another version of the code, on another architecture, or truncated), fall back
+  // to the ASCII file.
+  const std::string bin_filename = std::string(P3C::p3_lookup_bin_base) + std::string(P3C::p3_version);
+  if (not read_ice_lookup_tables_binary(bin_filename, ice_table, collect_table)) {
+    read_ice_lookup_tables_ascii(ice_table, collect_table);
+  }
+}
 
-  using DeviceIcetable = typename view_ice_table::non_const_type;
-  using DeviceColtable = typename view_collect_table::non_const_type;
+template <typename S, typename D>
+bool Functions<S,D>
+::read_ice_lookup_tables_binary(const std::string& filename,
+                                std::vector<double>& ice_table, std::vector<double>& collect_table)
+{
+  const int ice_size     = P3C::densize*P3C::rimsize*P3C::isize*P3C::ice_table_size;
+  const int collect_size = P3C::densize*P3C::rimsize*P3C::isize*P3C::rcollsize*P3C::collect_table_size;
 
-  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
-  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+  std::ifstream bin(filename, std::ios::binary);
+  if (not bin.good()) {
+    return false;
+  }
 
-  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
-  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+  ice_table_impl::BinaryHeader header;
+  bin.read(reinterpret_cast<char*>(&header),sizeof(header));
+  if (not bin.good()) {
+    return false;
+  }
+  header.p3_version[15] = '\0';
+
+  const std::int32_t dims[6] = {P3C::densize, P3C::rimsize, P3C::isize, P3C::ice_table_size,
+                                P3C::rcollsize, P3C::collect_table_size};
+  const bool valid = std::equal(header.magic,header.magic+8,ice_table_impl::bin_magic) &&
+                     header.format_version==ice_table_impl::bin_format_version &&
+                     header.byte_order==ice_table_impl::bin_byte_order &&
+                     header.double_size==static_cast<std::int32_t>(sizeof(double)) &&
+                     std::string(header.p3_version)==P3C::p3_version &&
+                     std::equal(dims,dims+6,header.dims);
+  if (not valid) {
+    return false;
+  }
+
+  ice_table.resize(ice_size);
+  collect_table.resize(collect_size);
+  bin.read(reinterpret_cast<char*>(ice_table.data()),ice_size*sizeof(double));
+  bin.read(reinterpret_cast<char*>(collect_table.data()),collect_size*sizeof(double));
+  return bin.good();
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::read_ice_lookup_tables_ascii(std::vector<double>& ice_table, std::vector<double>& collect_table)
+{
+  const int ice_size     = P3C::densize*P3C::rimsize*P3C::isize*P3C::ice_table_size;
+  const int collect_size = P3C::densize*P3C::rimsize*P3C::isize*P3C::rcollsize*P3C::collect_table_size;
+  ice_table.resize(ice_size);
+  collect_table.resize(collect_size);
 
   //
-  // read in ice microphysics table into host views
+  // read in ice microphysics table from ASCII file
   //
 
   std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
@@ -42,15 +116,15 @@ void Functions<S,D>
 
   // read tables
   double dum_s; int dum_i; // dum_s needs to be double to stream correctly
+  int ice_idx = 0, collect_idx = 0;
   for (int jj = 0; jj < P3C::densize; ++jj) {
     for (int ii = 0; ii < P3C::rimsize; ++ii) {
       for (int i = 0; i < P3C::isize; ++i) {
         in >> dum_i >> dum_i;
-        int j_idx = 0;
         for (int j = 0; j < 15; ++j) {
           in >> dum_s;
           if (j > 1 && j != 10) {
-            ice_table_vals_h(jj, ii, i, j_idx++) = dum_s;
+            ice_table[ice_idx++] = dum_s;
           }
         }
       }
@@ -58,17 +132,86 @@ void Functions<S,D>
       for (int i = 0; i < P3C::isize; ++i) {
         for (int j = 0; j < P3C::rcollsize; ++j) {
           in >> dum_i >> dum_i;
-          int k_idx = 0;
           for (int k = 0; k < 6; ++k) {
             in >> dum_s;
             if (k == 3 || k == 4) {
-              collect_table_vals_h(jj, ii, i, j, k_idx++) = std::log10(dum_s);
+              collect_table[collect_idx++] = std::log10(dum_s);
             }
           }
         }
       }
     }
   }
+  EKAT_REQUIRE_MSG(!in.fail(), "Bad " << filename << ", file ended before all table entries were read");
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::write_ice_lookup_tables_binary(const std::string& filename)
+{
+  std::vector<double> ice_table, collect_table;
+  read_ice_lookup_tables_ascii(ice_table, collect_table);
+
+  ice_table_impl::BinaryHeader header = {};
+  std::copy(ice_table_impl::bin_magic,ice_table_impl::bin_magic+8,header.magic);
+  header.format_version = ice_table_impl::bin_format_version;
+  header.byte_order = ice_table_impl::bin_byte_order;
+  header.double_size = sizeof(double);
+  std::string(P3C::p3_version).copy(header.p3_version,15);
+  const std::int32_t dims[6] = {P3C::densize, P3C::rimsize, P3C::isize, P3C::ice_table_size,
+                                P3C::rcollsize, P3C::collect_table_size};
+  std::copy(dims,dims+6,header.dims);
+
+  std::ofstream out(filename, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(&header),sizeof(header));
+  out.write(reinterpret_cast<const char*>(ice_table.data()),ice_table.size()*sizeof(double));
+  out.write(reinterpret_cast<const char*>(collect_table.data()),collect_table.size()*sizeof(double));
+  EKAT_REQUIRE_MSG(out.good(), "Error! Could not write binary ice lookup table file " << filename);
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::write_ice_lookup_tables_binary()
+{
+  write_ice_lookup_tables_binary(std::string(P3C::p3_lookup_bin_base) + std::string(P3C::p3_version));
+}
+
+namespace ice_table_impl {
+
+// Copy the flattened tables (as returned by read_ice_lookup_tables) into device views
+template <typename IceTable, typename CollectTable>
+void fill_views (const std::vector<double>& ice_table, const std::vector<double>& collect_table,
+                 IceTable& ice_table_vals, CollectTable& collect_table_vals)
+{
+  using DeviceIcetable = typename IceTable::non_const_type;
+  using DeviceColtable = typename CollectTable::non_const_type;
+
+  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
+  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+
+  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
+  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+
+  const int densize = ice_table_vals_h.extent(0);
+  const int rimsize = ice_table_vals_h.extent(1);
+  const int isize   = ice_table_vals_h.extent(2);
+  int ice_idx = 0, collect_idx = 0;
+  for (int jj = 0; jj < densize; ++jj) {
+    for (int ii = 0; ii < rimsize; ++ii) {
+      for (int i = 0; i < isize; ++i) {
+        for (int j = 0; j < static_cast<int>(ice_table_vals_h.extent(3)); ++j) {
+          ice_table_vals_h(jj, ii, i, j) = ice_table[ice_idx++];
+        }
+      }
+      for (int i = 0; i < isize; ++i) {
+        for (int j = 0; j < static_cast<int>(collect_table_vals_h.extent(3)); ++j) {
+          for (int k = 0; k < static_cast<int>(collect_table_vals_h.extent(4)); ++k) {
+            collect_table_vals_h(jj, ii, i, j, k) = collect_table[collect_idx++];
+          }
+        }
+      }
+    }
+  }
 
   // deep copy to device
   Kokkos::deep_copy(ice_table_vals_d, ice_table_vals_h);
@@ -77,6 +220,37 @@ void Functions<S,D>
   collect_table_vals = collect_table_vals_d;
 }
 
+} // namespace ice_table_impl
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+  std::vector<double> ice_table, collect_table;
+  read_ice_lookup_tables(ice_table, collect_table);
+  ice_table_impl::fill_views(ice_table, collect_table, ice_table_vals, collect_table_vals);
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+                                const ekat::Comm& comm) {
+  //
+  // read in ice microphysics table on the root rank, and broadcast it
+  //
+
+  std::vector<double> ice_table, collect_table;
+  if (comm.am_i_root()) {
+    read_ice_lookup_tables(ice_table, collect_table);
+  } else {
+    ice_table.resize(P3C::densize*P3C::rimsize*P3C::isize*P3C::ice_table_size);
+    collect_table.resize(P3C::densize*P3C::rimsize*P3C::isize*P3C::rcollsize*P3C::collect_table_size);
+  }
+  comm.broadcast(ice_table.data(), ice_table.size(), comm.root_rank());
+  comm.broadcast(collect_table.data(), collect_table.size(), comm.root_rank());
+
+  ice_table_impl::fill_views(ice_table, collect_table, ice_table_vals, collect_table_vals);
+}
+
 template <typename S, typename D>
 KOKKOS_FUNCTION
 void Functions<S,D>
@@ -7,6 +7,9 @@
 
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <vector>
 
 namespace scream {
 namespace p3 {
@@ -46,6 +49,8 @@ struct Functions
 
     static constexpr ScalarT lookup_table_1a_dum1_c =  4.135985029041767e+00; // 1.0/(0.1*log10(261.7))
     static constexpr const char* p3_lookup_base = SCREAM_DATA_DIR "/tables/p3_lookup_table_1.dat-v";
+    // Binary version of the ice lookup table, generated by p3_tables_setup
+    static constexpr const char* p3_lookup_bin_base = SCREAM_DATA_DIR "/tables/p3_lookup_table_1.bin-v";
 
     static constexpr const char* p3_version = "4.1.1"; // TODO: Change this so that the table version and table path is a runtime option.
   };
@@ -271,6 +276,30 @@ struct Functions
   static void init_kokkos_ice_lookup_tables(
     view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
 
+  // Same as above, but only the root rank of the comm reads the table file,
+  // and then broadcasts the tables to all other ranks.
+  static void init_kokkos_ice_lookup_tables(
+    view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+    const ekat::Comm& comm);
+
+  // Read the ice lookup tables on host, in flattened (row-major) arrays. The binary
+  // table file is used if present and valid, otherwise the ASCII file is parsed.
+  static void read_ice_lookup_tables(
+    std::vector<double>& ice_table, std::vector<double>& collect_table);
+
+  // Read the ice lookup tables from the given binary file. Returns false if the file
+  // is missing, incomplete, or was generated for another p3 version or architecture.
+  static bool read_ice_lookup_tables_binary(const std::string& filename,
+    std::vector<double>& ice_table, std::vector<double>& collect_table);
+
+  // Read the ice lookup tables from the ASCII file.
+  static void read_ice_lookup_tables_ascii(
+    std::vector<double>& ice_table, std::vector<double>& collect_table);
+
+  // Write the ice lookup tables in binary format, to be used by read_ice_lookup_tables.
+  static void write_ice_lookup_tables_binary(const std::string& filename);
+  static void write_ice_lookup_tables_binary();
+
   // Map (mu_r, lamr) to Table3 data.
   KOKKOS_FUNCTION
   static void lookup(const Spack& mu_r, const Spack& lamr,
@@ -1,8 +1,14 @@
 // This is a tiny program that calls p3_init() to generate tables used by p3
 
 #include "physics/p3/p3_f90.hpp"
+#include "physics/p3/p3_functions.hpp"
 
 int main(int /* argc */, char** /* argv */) {
   scream::p3::p3_init(/* write_tables = */ true);
+
+  // Also write the ice lookup table in binary format, which is much faster to
+  // read at init time than the ASCII one
+  using P3F = scream::p3::Functions<scream::Real, scream::DefaultDevice>;
+  P3F::write_ice_lookup_tables_binary();
   return 0;
 }
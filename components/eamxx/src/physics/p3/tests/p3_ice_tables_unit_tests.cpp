@@ -12,6 +12,12 @@
 #include <array>
 #include <algorithm>
 #include <random>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
 
 namespace scream {
 namespace p3 {
@@ -61,6 +67,57 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
     }
   }
 
+  static void test_binary_lookup_tables()
+  {
+    using P3C = typename Functions::P3C;
+
+    // Tables from the ASCII file
+    std::vector<double> ice_ascii, collect_ascii;
+    Functions::read_ice_lookup_tables_ascii(ice_ascii, collect_ascii);
+
+    // Write-then-read round trip must give the same tables
+    const std::string filename = "p3_ice_tables_unit_tests.bin";
+    Functions::write_ice_lookup_tables_binary(filename);
+    std::vector<double> ice_bin, collect_bin;
+    REQUIRE(Functions::read_ice_lookup_tables_binary(filename, ice_bin, collect_bin));
+    REQUIRE(ice_bin == ice_ascii);
+    REQUIRE(collect_bin == collect_ascii);
+
+    // Load the file content, so we can corrupt it
+    std::string content;
+    {
+      std::ifstream in(filename, std::ios::binary);
+      content.assign(std::istreambuf_iterator<char>(in),std::istreambuf_iterator<char>());
+    }
+    auto write_file = [&](const std::string& bytes) {
+      std::ofstream out(filename, std::ios::binary);
+      out.write(bytes.data(),bytes.size());
+    };
+
+    // A file from another p3 version is rejected (not an error)
+    const auto vpos = content.find(P3C::p3_version);
+    REQUIRE(vpos != std::string::npos);
+    auto bad_version = content;
+    bad_version[vpos] = bad_version[vpos]=='9' ? '8' : '9';
+    write_file(bad_version);
+    REQUIRE(not Functions::read_ice_lookup_tables_binary(filename, ice_bin, collect_bin));
+
+    // A file with the opposite byte order is rejected
+    auto bad_endian = content;
+    const auto bpos = 8 + sizeof(std::int32_t);
+    std::reverse(&bad_endian[bpos],&bad_endian[bpos+sizeof(std::uint32_t)]);
+    write_file(bad_endian);
+    REQUIRE(not Functions::read_ice_lookup_tables_binary(filename, ice_bin, collect_bin));
+
+    // A truncated file is rejected
+    write_file(content.substr(0,content.size()/2));
+    REQUIRE(not Functions::read_ice_lookup_tables_binary(filename, ice_bin, collect_bin));
+
+    // A missing file is rejected
+    std::remove(filename.c_str());
+    REQUIRE(not Functions::read_ice_lookup_tables_binary(filename, ice_bin, collect_bin));
+  }
+
   template <typename View>
   static void init_table_linear_dimension(View& table, int linear_dimension)
   {
@@ -346,6 +403,7 @@ TEST_CASE("p3_ice_tables", "[p3_functions]")
   using TTI = scream::p3::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestTableIce;
 
   TTI::test_read_lookup_tables_bfb();
+  TTI::test_binary_lookup_tables();
   TTI::run_phys();
   TTI::run_bfb();
 }
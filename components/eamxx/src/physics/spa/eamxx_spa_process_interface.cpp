@@ -18,6 +18,8 @@ SPA::SPA (const ekat::Comm& comm, const ekat::ParameterList& params)
 {
   EKAT_REQUIRE_MSG(m_params.isParameter("spa_data_file"),
       "ERROR: spa_data_file is missing from SPA parameter list.");
+
+  m_prefetch_data = m_params.get<bool>("prefetch_data",false);
 }
 
 // =========================================================================================
@@ -229,6 +231,10 @@ void SPA::initialize_impl (const RunType /* run_type */)
   //       and spa_end will be reloaded from file with the new month.
   const int curr_month = timestamp().get_month()-1; // 0-based
   SPAFunc::update_spa_data_from_file(SPADataReader,SPAIOPDataReader,timestamp(),curr_month,*SPAHorizInterp,SPAData_end);
+  if (m_prefetch_data and not SPAIOPDataReader) {
+    // The first call to run_impl will need next month's data
+    SPADataReader->prefetch_variables((curr_month + 1) % 12);
+  }
 
   // 6. Set property checks for fields in this process
   using Interval = FieldWithinIntervalCheck;
@@ -250,7 +256,7 @@ void SPA::run_impl (const double dt)
   /* Update the SPATimeState to reflect the current time, note the addition of dt */
   SPATimeState.t_now = ts.frac_of_year_in_days();
   /* Update time state and if the month has changed, update the data.*/
-    SPAFunc::update_spa_timestate(SPADataReader,SPAIOPDataReader,ts,*SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+    SPAFunc::update_spa_timestate(SPADataReader,SPAIOPDataReader,ts,*SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end,m_prefetch_data);
 
   // Call the main SPA routine to get interpolated aerosol forcings.
   const auto& pmid_tgt = get_field_in("p_mid").get_view<const Spack**>();
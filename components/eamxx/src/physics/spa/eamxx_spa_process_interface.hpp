@@ -82,6 +82,9 @@ protected:
   // Similar to above, but stores info to read data for IOP grid
   std::shared_ptr<SPAFunc::IOPReader>  SPAIOPDataReader;
 
+  // Whether to read next month's data in the background
+  bool m_prefetch_data;
+
   // Structures to store the data used for interpolation
   std::shared_ptr<AbstractRemapper>  SPAHorizInterp;
 
@@ -203,7 +203,8 @@ struct SPAFunctions
     AbstractRemapper&                 spa_horiz_interp,
     SPATimeState&                     time_state,
     SPAInput&                         spa_beg,
-    SPAInput&                         spa_end);
+    SPAInput&                         spa_end,
+    const bool                        prefetch_next_month = false);
 
   // The following three are called during spa_main
   static void perform_time_interpolation (
@@ -559,7 +559,8 @@ void SPAFunctions<S,D>
     AbstractRemapper&                 spa_horiz_interp,
     SPATimeState&                     time_state,
     SPAInput&                         spa_beg,
-    SPAInput&                         spa_end)
+    SPAInput&                         spa_end,
+    const bool                        prefetch_next_month)
 {
   // Now we check if we have to update the data that changes monthly
   // NOTE:  This means that SPA assumes monthly data to update.  Not
@@ -581,6 +582,12 @@ void SPAFunctions<S,D>
     //       will proceed.
     int next_month = (time_state.current_month + 1) % 12;
     update_spa_data_from_file(scorpio_reader,iop_reader,ts,next_month,spa_horiz_interp,spa_end);
+
+    // Start reading the data for the following month in the background, so that
+    // the next month change does not have to wait on I/O.
+    if (prefetch_next_month and not iop_reader) {
+      scorpio_reader->prefetch_variables((next_month + 1) % 12);
+    }
   }
 
 } // END updata_spa_timestate
@@ -74,29 +74,40 @@ TEST_CASE("spa_read_data","spa")
   auto aer_tau_sw_h = Kokkos::create_mirror_view(aer_tau_sw_d);
   auto aer_tau_lw_h = Kokkos::create_mirror_view(aer_tau_lw_d);
 
+  // Read the data directly, then again with prefetching (which does nothing
+  // if async I/O is not supported). Both must give the expected values.
   const int max_time = 3;
-  for (int time_index = 0;time_index<max_time; time_index++) {
-    SPAFunc::update_spa_data_from_file(reader, dummy_iop_reader, dummy_iop_ts, time_index, *remapper, spa_data);
-
-    Kokkos::deep_copy(ps_h,        ps_d);
-    Kokkos::deep_copy(ccn3_h,      ccn3_d);
-    Kokkos::deep_copy(aer_g_sw_h,  aer_g_sw_d);
-    Kokkos::deep_copy(aer_ssa_sw_h,aer_ssa_sw_d);
-    Kokkos::deep_copy(aer_tau_sw_h,aer_tau_sw_d);
-    Kokkos::deep_copy(aer_tau_lw_h,aer_tau_lw_d);
-
-    for (int idof=0; idof<grid_model->get_num_local_dofs(); ++idof) {
-      REQUIRE(std::abs(ps_h(idof) - ps_func(time_index,ncols_data))<tol);
-      for (int kk=0; kk<nlevs; kk++) {
-        // Recall, SPA data read from file is padded, so we need to offset the kk index for the data by 1.
-        REQUIRE(std::abs(ccn3_h(idof,kk+1) - ccn3_func(time_index, kk, ncols_data))<tol);
-        for (int n=0; n<nswbands; n++) {
-          REQUIRE(aer_g_sw_h(idof,n,kk+1)   == aer_func(time_index,n,kk,ncols_data,0));
-          REQUIRE(aer_ssa_sw_h(idof,n,kk+1) == aer_func(time_index,n,kk,ncols_data,1));
-          REQUIRE(aer_tau_sw_h(idof,n,kk+1) == aer_func(time_index,n,kk,ncols_data,2));
-        }
-        for (int n=0; n<nlwbands; n++) {
-          REQUIRE(aer_tau_lw_h(idof,n,kk+1) ==  aer_func(time_index,n,kk,ncols_data,3));
+  for (const bool prefetch : {false, true}) {
+    if (prefetch) {
+      // A prefetch of the wrong time slice must be discarded
+      reader->prefetch_variables(max_time-1);
+    }
+    for (int time_index = 0;time_index<max_time; time_index++) {
+      SPAFunc::update_spa_data_from_file(reader, dummy_iop_reader, dummy_iop_ts, time_index, *remapper, spa_data);
+      if (prefetch and time_index+1<max_time) {
+        reader->prefetch_variables(time_index+1);
+      }
+
+      Kokkos::deep_copy(ps_h,        ps_d);
+      Kokkos::deep_copy(ccn3_h,      ccn3_d);
+      Kokkos::deep_copy(aer_g_sw_h,  aer_g_sw_d);
+      Kokkos::deep_copy(aer_ssa_sw_h,aer_ssa_sw_d);
+      Kokkos::deep_copy(aer_tau_sw_h,aer_tau_sw_d);
+      Kokkos::deep_copy(aer_tau_lw_h,aer_tau_lw_d);
+
+      for (int idof=0; idof<grid_model->get_num_local_dofs(); ++idof) {
+        REQUIRE(std::abs(ps_h(idof) - ps_func(time_index,ncols_data))<tol);
+        for (int kk=0; kk<nlevs; kk++) {
+          // Recall, SPA data read from file is padded, so we need to offset the kk index for the data by 1.
+          REQUIRE(std::abs(ccn3_h(idof,kk+1) - ccn3_func(time_index, kk, ncols_data))<tol);
+          for (int n=0; n<nswbands; n++) {
+            REQUIRE(aer_g_sw_h(idof,n,kk+1)   == aer_func(time_index,n,kk,ncols_data,0));
+            REQUIRE(aer_ssa_sw_h(idof,n,kk+1) == aer_func(time_index,n,kk,ncols_data,1));
+            REQUIRE(aer_tau_sw_h(idof,n,kk+1) == aer_func(time_index,n,kk,ncols_data,2));
+          }
+          for (int n=0; n<nlwbands; n++) {
+            REQUIRE(aer_tau_lw_h(idof,n,kk+1) ==  aer_func(time_index,n,kk,ncols_data,3));
+          }
         }
       }
     }
@@ -66,8 +66,9 @@ AtmosphereProcess (const ekat::Comm& comm, const ekat::ParameterList& params)
 }
 
 void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type) {
+  register_timers();
   if (this->type()!=AtmosphereProcessType::Group) {
-    start_timer (m_timer_prefix + this->name() + "::init");
+    start_timer (m_timers.init);
   }
   set_fields_and_groups_pointers();
   m_time_stamp = t0;
@@ -81,13 +82,13 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
   }
 
   if (this->type()!=AtmosphereProcessType::Group) {
-    stop_timer (m_timer_prefix + this->name() + "::init");
+    stop_timer (m_timers.init);
   }
 }
 
 void AtmosphereProcess::run (const double dt) {
   m_atm_logger->debug("[EAMxx::" + this->name() + "] run...");
-  start_timer (m_timer_prefix + this->name() + "::run");
+  start_timer (m_timers.run);
   if (m_params.get("enable_precondition_checks", true)) {
     // Run 'pre-condition' property checks stored in this AP
     run_precondition_checks();
@@ -138,7 +139,7 @@ void AtmosphereProcess::run (const double dt) {
     // Update all output fields time stamps
     update_time_stamps ();
   }
-  stop_timer (m_timer_prefix + this->name() + "::run");
+  stop_timer (m_timers.run);
 }
 
 void AtmosphereProcess::finalize (/* what inputs? */) {
@@ -458,49 +459,49 @@ void AtmosphereProcess::run_property_check (const prop_check_ptr&       property
 
 void AtmosphereProcess::run_precondition_checks () const {
   m_atm_logger->debug("[" + this->name() + "] run_precondition_checks...");
-  start_timer(m_timer_prefix + this->name() + "::run-precondition-checks");
+  start_timer(m_timers.precondition_checks);
   // Run all pre-condition property checks
   for (const auto& it : m_precondition_checks) {
     run_property_check(it.second, it.first,
                        PropertyCheckCategory::Precondition);
   }
-  stop_timer(m_timer_prefix + this->name() + "::run-precondition-checks");
+  stop_timer(m_timers.precondition_checks);
   m_atm_logger->debug("[" + this->name() + "] run_precondition_checks...done!");
 }
 
 void AtmosphereProcess::run_postcondition_checks () const {
   m_atm_logger->debug("[" + this->name() + "] run_postcondition_checks...");
-  start_timer(m_timer_prefix + this->name() + "::run-postcondition-checks");
+  start_timer(m_timers.postcondition_checks);
   // Run all post-condition property checks
   for (const auto& it : m_postcondition_checks) {
     run_property_check(it.second, it.first,
                        PropertyCheckCategory::Postcondition);
   }
-  stop_timer(m_timer_prefix + this->name() + "::run-postcondition-checks");
+  stop_timer(m_timers.postcondition_checks);
   m_atm_logger->debug("[" + this->name() + "] run_postcondition_checks...done!");
 }
 
 void AtmosphereProcess::run_column_conservation_check () const {
   m_atm_logger->debug("[" + this->name() + "] run_column_conservation_check...");
-  start_timer(m_timer_prefix + this->name() + "::run-column-conservation-checks");
+  start_timer(m_timers.conservation_checks);
   // Conservation check is run as a postcondition check
   run_property_check(m_column_conservation_check.second,
                      m_column_conservation_check.first,
                      PropertyCheckCategory::Postcondition);
-  stop_timer(m_timer_prefix + this->name() + "::run-column-conservation-checks");
+  stop_timer(m_timers.conservation_checks);
   m_atm_logger->debug("[" + this->name() + "] run_column-conservation_checks...done!");
 }
 
 void AtmosphereProcess::init_step_tendencies () {
   if (m_compute_proc_tendencies) {
-    start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    start_timer(m_timers.compute_tendencies);
     for (auto& it : m_start_of_step_fields) {
       const auto& fname = it.first;
       const auto& f     = get_field_out(fname);
             auto& f_beg = it.second;
       f_beg.deep_copy(f);
     }
-    stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    stop_timer(m_timers.compute_tendencies);
   }
 }
 
@@ -508,7 +509,7 @@ void AtmosphereProcess::compute_step_tendencies (const double dt) {
   using namespace ShortFieldTagsNames;
   if (m_compute_proc_tendencies) {
     m_atm_logger->debug("[" + this->name() + "] computing tendencies...");
-    start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    start_timer(m_timers.compute_tendencies);
     for (auto it : m_proc_tendencies) {
       // Note: f_beg is nonconst, so we can store step tendency in it
       const auto& tname = it.first;
@@ -521,7 +522,7 @@ void AtmosphereProcess::compute_step_tendencies (const double dt) {
       f_beg.update(f,1,-1);
       tend.update(f_beg,1,1);
     }
-    stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    stop_timer(m_timers.compute_tendencies);
   }
 }
 
@@ -791,6 +792,16 @@ add_column_conservation_check(const prop_check_ptr &prop_check, const CheckFailH
   m_column_conservation_check = std::make_pair(cfh,prop_check);
 }
 
+void AtmosphereProcess::register_timers () {
+  const auto root = m_timer_prefix + this->name();
+  m_timers.init                 = register_timer(root + "::init");
+  m_timers.run                  = register_timer(root + "::run");
+  m_timers.precondition_checks  = register_timer(root + "::run-precondition-checks");
+  m_timers.postcondition_checks = register_timer(root + "::run-postcondition-checks");
+  m_timers.conservation_checks  = register_timer(root + "::run-column-conservation-checks");
+  m_timers.compute_tendencies   = register_timer(root + "::compute_tendencies");
+}
+
 void AtmosphereProcess::set_fields_and_groups_pointers () {
   for (auto& f : m_fields_in) {
     const auto& fid = f.get_header().get_identifier();
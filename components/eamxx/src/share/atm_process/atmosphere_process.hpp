@@ -491,6 +491,10 @@ private:
   // maps, which are used inside the get_[field|group]_[in|out] methods.
   void set_fields_and_groups_pointers ();
 
+  // Called from initialize, this method registers the timers of this atm proc,
+  // so that we don't need to build their names at every call to run.
+  void register_timers ();
+
   // Getters that can be called on both const and non-const objects
   Field& get_field_in_impl(const std::string& field_name, const std::string& grid_name) const;
   Field& get_field_in_impl(const std::string& field_name) const;
@@ -585,6 +589,17 @@ private:
   // Controls global hashing output for debugging non-BFBness.
   int m_internal_diagnostics_level;
 
+  // Handles of the timers of this atm proc
+  struct TimerHandles {
+    int init                 = -1;
+    int run                  = -1;
+    int precondition_checks  = -1;
+    int postcondition_checks = -1;
+    int conservation_checks  = -1;
+    int compute_tendencies   = -1;
+  };
+  TimerHandles m_timers;
+
 protected:
 
   // IOP object
@@ -2,6 +2,7 @@
 #include "share/field/field_utils.hpp"
 
 #include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/batched_field_nan_check.hpp"
 
 #include "ekat/std_meta/ekat_std_utils.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
@@ -328,19 +329,34 @@ void AtmosphereProcessGroup::add_postcondition_nan_checks () const {
     if (group) {
       group->add_postcondition_nan_checks();
     } else {
-      for (const auto& f : proc->get_fields_out()) {
+      // Real-valued fields on the same grid are checked in a single batch,
+      // to avoid launching one (tiny) kernel per field. Other fields get
+      // their own check.
+      std::map<std::string,std::list<Field>> batched_fields;
+      auto add_nan_check = [&](const Field& f) {
         const auto& grid_name = f.get_header().get_identifier().get_grid_name();
-        auto nan_check = std::make_shared<FieldNaNCheck>(f,m_grids_mgr->get_grid(grid_name));
-        proc->add_postcondition_check(nan_check, CheckFailHandling::Fatal);
+        if (f.data_type()==get_data_type<Real>()) {
+          batched_fields[grid_name].push_back(f);
+        } else {
+          auto nan_check = std::make_shared<FieldNaNCheck>(f,m_grids_mgr->get_grid(grid_name));
+          proc->add_postcondition_check(nan_check, CheckFailHandling::Fatal);
+        }
+      };
+
+      for (const auto& f : proc->get_fields_out()) {
+        add_nan_check(f);
       }
 
       for (const auto& g : proc->get_groups_out()) {
-        const auto& grid = m_grids_mgr->get_grid(g.grid_name());
         for (const auto& f : g.m_fields) {
-          auto nan_check = std::make_shared<FieldNaNCheck>(*f.second,grid);
-          proc->add_postcondition_check(nan_check, CheckFailHandling::Fatal);
+          add_nan_check(*f.second);
         }
       }
+
+      for (const auto& it : batched_fields) {
+        auto nan_check = std::make_shared<BatchedFieldNaNCheck>(it.second,m_grids_mgr->get_grid(it.first));
+        proc->add_postcondition_check(nan_check, CheckFailHandling::Fatal);
+      }
     }
   }
 }
@@ -348,66 +348,9 @@ AbstractGrid::get_unique_gids () const
 std::vector<int> AbstractGrid::
 get_owners (const gid_view_h& gids) const
 {
-  const auto& comm = get_comm();
-
-  // Init owners to in
-  std::map<gid_type,int> owners;
-  int num_gids_in = gids.size();
-  for (int i=0; i<num_gids_in; ++i) {
-    owners[gids[i]] = -1;
-  }
-  int num_found = 0;
-
-  // Let each rank bcast its owned gids, so that other procs can
-  // check against their input list
-  // Note: we can't use a view of const, since the view ptr needs to be passed
-  //       to MPI bcast routines, which expect pointer to nonconst. It's an
-  //       innocuous issue though, since only the send rank will use the ptr
-  //       from the view, and it's not writing in it.
-  auto my_gids_h = m_dofs_gids.get_view<gid_type*,Host>();
-  gid_type* data;
-  std::vector<gid_type> pid_gids;
-  for (int pid=0; pid<comm.size(); ++pid) {
-    // Bcast gids count for this pid
-    int num_gids_pid = my_gids_h.size();
-    comm.broadcast(&num_gids_pid,1,pid);
-
-    // Bcast gids
-    if (pid==comm.rank()) {
-      data = my_gids_h.data();
-    } else {
-      pid_gids.resize(num_gids_pid);
-      data = pid_gids.data();
-    }
-    comm.broadcast(data,num_gids_pid,pid);
-
-    // Checks if any of the input pids is in this list
-    for (int i=0; i<num_gids_pid && num_found<num_gids_in; ++i) {
-      auto it = owners.find(data[i]);
-      if (it!=owners.end()) {
-        EKAT_REQUIRE_MSG (it->second==-1,
-            "Error! Found a GID with multiple owners.\n"
-            "  - owner 1: " + std::to_string(it->second) + "\n"
-            "  - owner 2: " + std::to_string(pid) + "\n");
-        it->second = pid;
-        ++num_found;
-      }
-    }
-  }
-  EKAT_REQUIRE_MSG (num_found==static_cast<int>(owners.size()),
-      "Error! Could not locate the owner of one of the input GIDs.\n"
-      "  - rank: " + std::to_string(comm.rank()) + "\n"
-      "  - num found: " + std::to_string(num_found) + "\n"
-      "  - num gids in: " + std::to_string(num_gids_in) + "\n");
-
-
-  // Now create and fill output view
-  std::vector<int> result(num_gids_in);
-  for (int i=0; i<num_gids_in; ++i) {
-    result[i] = owners.at(gids[i]);
-  }
-
-  return result;
+  std::vector<int> pids, lids;
+  get_remote_pids_and_lids (gids,pids,lids);
+  return pids;
 }
 
 void AbstractGrid::
@@ -415,61 +358,150 @@ get_remote_pids_and_lids (const gid_view_h& gids,
                           std::vector<int>& pids,
                           std::vector<int>& lids) const
 {
+  // We use a distributed directory: each gid is assigned to a "directory" rank,
+  // obtained by splitting the range [min_gid,max_gid] in comm.size() chunks.
+  // 1. Each rank sends (gid,lid) of its dofs to the directory rank of each gid.
+  // 2. Each rank sends the input gids to their directory rank, which replies
+  //    with the (pid,lid) of the owner.
+  // Each phase is a single all-to-all exchange, with a volume proportional to
+  // the number of local gids (rather than the number of global gids).
   const auto& comm = get_comm();
-  int num_gids_in = gids.size();
+  const int nranks = comm.size();
+  const auto mpi_gid_t = ekat::get_mpi_type<gid_type>();
+  const auto mpi_comm = comm.mpi_comm();
 
-  pids.resize(num_gids_in,-1);
-  lids.resize(num_gids_in,-1);
+  const long long min_gid = get_global_min_dof_gid();
+  const long long num_gids_range = std::max(1LL,get_global_max_dof_gid() - min_gid + 1);
+  auto dir_pid = [&](const gid_type gid) {
+    const long long pid = (gid-min_gid)*nranks / num_gids_range;
+    return static_cast<int>(std::max(0LL,std::min(pid,static_cast<long long>(nranks-1))));
+  };
 
-  int num_found = 0;
+  // Helper lambda, to exchange send counts and compute send/recv offsets
+  auto setup_exchange = [&](const std::vector<int>& send_count,
+                            std::vector<int>& recv_count,
+                            std::vector<int>& send_offset,
+                            std::vector<int>& recv_offset) {
+    recv_count.resize(nranks);
+    send_offset.assign(nranks+1,0);
+    recv_offset.assign(nranks+1,0);
+    MPI_Alltoall (send_count.data(),1,MPI_INT,
+                  recv_count.data(),1,MPI_INT,mpi_comm);
+    for (int pid=0; pid<nranks; ++pid) {
+      send_offset[pid+1] = send_offset[pid] + send_count[pid];
+      recv_offset[pid+1] = recv_offset[pid] + recv_count[pid];
+    }
+  };
+
+  // ------------- Phase 1: register local dofs in the directory ------------- //
+  auto my_gids_h = m_dofs_gids.get_view<const gid_type*,Host>();
+  const int num_my_gids = my_gids_h.size();
+
+  std::vector<int> send_count(nranks,0), recv_count, send_offset, recv_offset;
+  for (int i=0; i<num_my_gids; ++i) {
+    ++send_count[dir_pid(my_gids_h[i])];
+  }
+  setup_exchange(send_count,recv_count,send_offset,recv_offset);
+
+  // We send gids and lids separately, to avoid custom MPI data types
+  std::vector<gid_type> send_gids(num_my_gids);
+  std::vector<int>      send_lids(num_my_gids);
+  {
+    auto pos = send_offset;
+    for (int i=0; i<num_my_gids; ++i) {
+      auto& p = pos[dir_pid(my_gids_h[i])];
+      send_gids[p] = my_gids_h[i];
+      send_lids[p] = i;
+      ++p;
+    }
+  }
+  std::vector<gid_type> recv_gids(recv_offset[nranks]);
+  std::vector<int>      recv_lids(recv_offset[nranks]);
+  MPI_Alltoallv (send_gids.data(),send_count.data(),send_offset.data(),mpi_gid_t,
+                 recv_gids.data(),recv_count.data(),recv_offset.data(),mpi_gid_t,mpi_comm);
+  MPI_Alltoallv (send_lids.data(),send_count.data(),send_offset.data(),MPI_INT,
+                 recv_lids.data(),recv_count.data(),recv_offset.data(),MPI_INT,mpi_comm);
+
+  // Directory entries: gid -> (pid,lid). A gid found on multiple ranks is only
+  // an error if someone asks for its owner, so just keep track of it for now.
+  std::map<gid_type,std::pair<int,int>> directory;
+  std::map<gid_type,int> dup_owners;
+  for (int pid=0; pid<nranks; ++pid) {
+    for (int k=recv_offset[pid]; k<recv_offset[pid+1]; ++k) {
+      auto it_bool = directory.emplace(recv_gids[k],std::make_pair(pid,recv_lids[k]));
+      if (not it_bool.second) {
+        dup_owners.emplace(recv_gids[k],pid);
+      }
+    }
+  }
+
+  // ------------- Phase 2: query the directory for the input gids ------------- //
 
   // We may have repeated gids. In that case, we want to update
   // the pids/lids arrays at all indices corresponding to the same gid
+  const int num_gids_in = gids.size();
   std::map<gid_type,std::vector<int>> gid2idx;
   for (int i=0; i<num_gids_in; ++i) {
     gid2idx[gids[i]].push_back(i);
   }
-  int num_unique_gids = gid2idx.size();
-
-  // Let each rank bcast its owned gids, so that other procs can
-  // check against their input list
-  // Note: we can't use a view of const, since the view ptr needs to be passed
-  //       to MPI bcast routines, which expect pointer to nonconst. It's an
-  //       innocuous issue though, since only the send rank will use the ptr
-  //       from the view, and it's not writing in it.
-  auto my_gids_h = m_dofs_gids.get_view<gid_type*,Host>();
-  gid_type* data;
-  std::vector<gid_type> pid_gids;
-  for (int pid=0; pid<comm.size(); ++pid) {
-    // Bcast gids count for this pid
-    int num_gids_pid = my_gids_h.size();
-    comm.broadcast(&num_gids_pid,1,pid);
-
-    // Bcast gids
-    if (pid==comm.rank()) {
-      data = my_gids_h.data();
-    } else {
-      pid_gids.resize(num_gids_pid);
-      data = pid_gids.data();
+
+  std::fill(send_count.begin(),send_count.end(),0);
+  for (const auto& it : gid2idx) {
+    ++send_count[dir_pid(it.first)];
+  }
+  setup_exchange(send_count,recv_count,send_offset,recv_offset);
+
+  std::vector<gid_type> query_gids(send_offset[nranks]);
+  {
+    // Note: gid2idx is sorted, and so is dir_pid(gid) as a function of gid,
+    //       so we can simply fill the send buffer in order.
+    int k = 0;
+    for (const auto& it : gid2idx) {
+      query_gids[k++] = it.first;
     }
-    comm.broadcast(data,num_gids_pid,pid);
-
-    // Checks if any of the input pids is in this list
-    for (int i=0; i<num_gids_pid; ++i) {
-      auto it = gid2idx.find(data[i]);
-      if (it!=gid2idx.end()) {
-        for (auto idx : it->second) {
-          EKAT_REQUIRE_MSG (pids[idx]==-1,
-              "Error! Found a GID with multiple owners.\n"
-              "  - owner 1: " + std::to_string(pids[idx]) + "\n"
-              "  - owner 2: " + std::to_string(pid) + "\n");
-          pids[idx] = pid;
-          lids[idx] = i;
-        }
-        ++num_found;
-      }
+  }
+  recv_gids.resize(recv_offset[nranks]);
+  MPI_Alltoallv (query_gids.data(),send_count.data(),send_offset.data(),mpi_gid_t,
+                 recv_gids.data(),recv_count.data(),recv_offset.data(),mpi_gid_t,mpi_comm);
+
+  // Answer the queries. The reply has the same layout of the query (with swapped
+  // send/recv), so we can reuse counts and offsets.
+  const int num_queries = recv_offset[nranks];
+  std::vector<int> reply_pids(num_queries,-1), reply_lids(num_queries,-1);
+  for (int k=0; k<num_queries; ++k) {
+    auto it = directory.find(recv_gids[k]);
+    if (it!=directory.end()) {
+      auto dup = dup_owners.find(recv_gids[k]);
+      EKAT_REQUIRE_MSG (dup==dup_owners.end(),
+          "Error! Found a GID with multiple owners.\n"
+          "  - gid: " + std::to_string(recv_gids[k]) + "\n"
+          "  - owner 1: " + std::to_string(it->second.first) + "\n"
+          "  - owner 2: " + std::to_string(dup->second) + "\n");
+      reply_pids[k] = it->second.first;
+      reply_lids[k] = it->second.second;
+    }
+  }
+  std::vector<int> query_pids(send_offset[nranks]), query_lids(send_offset[nranks]);
+  MPI_Alltoallv (reply_pids.data(),recv_count.data(),recv_offset.data(),MPI_INT,
+                 query_pids.data(),send_count.data(),send_offset.data(),MPI_INT,mpi_comm);
+  MPI_Alltoallv (reply_lids.data(),recv_count.data(),recv_offset.data(),MPI_INT,
+                 query_lids.data(),send_count.data(),send_offset.data(),MPI_INT,mpi_comm);
+
+  // Fill output vectors
+  pids.assign(num_gids_in,-1);
+  lids.assign(num_gids_in,-1);
+  int k = 0, num_found = 0;
+  for (const auto& it : gid2idx) {
+    if (query_pids[k]>=0) {
+      ++num_found;
+    }
+    for (auto idx : it.second) {
+      pids[idx] = query_pids[k];
+      lids[idx] = query_lids[k];
     }
+    ++k;
   }
+  const int num_unique_gids = gid2idx.size();
   EKAT_REQUIRE_MSG (num_found==num_unique_gids,
       "Error! Could not locate the owner of one of the input GIDs.\n"
       "  - rank: " + std::to_string(comm.rank()) + "\n"
@@ -7,7 +7,7 @@
 #include <ekat/kokkos/ekat_kokkos_utils.hpp>
 #include <ekat/ekat_pack_utils.hpp>
 
-#include <numeric>
+#include <map>
 
 namespace scream
 {
@@ -164,8 +164,17 @@ void CoarseningRemapper::do_remap_fwd ()
     return (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
   };
 
+  if (not m_mat_vec_batches_set) {
+    setup_mat_vec_batches ();
+  }
+
   // Loop over each field
   for (int i=0; i<m_num_fields; ++i) {
+    if (m_is_batched[i]) {
+      // Handled below, together with other fields
+      continue;
+    }
+
     // First, perform the local mat-vec. Recall that in these y=Ax products,
     // x is the src field, and y is the overlapped tgt field.
     const auto& f_src = m_src_fields[i];
@@ -192,6 +201,11 @@ void CoarseningRemapper::do_remap_fwd ()
     }
   }
 
+  // Batched mat-vec, writing directly in the send buffer
+  for (const auto& batch : m_mat_vec_batches) {
+    local_mat_vec_and_pack (batch);
+  }
+
   // Pack, then fire off the sends
   pack_and_send ();
 
@@ -564,6 +578,89 @@ local_mat_vec (const Field& x, const Field& y, const Field& mask) const
   }
 }
 
+void CoarseningRemapper::setup_mat_vec_batches ()
+{
+  using namespace ShortFieldTagsNames;
+
+  // A field can be batched if it is not masked, and its src data is
+  // contiguous, so that it can be accessed as a (ncols,col_size) array.
+  // Group these fields by col_size, and split groups in batches of
+  // at most s_max_batch_size fields.
+  std::map<int,std::vector<int>> col_size2fields;
+  m_is_batched.assign(m_num_fields,false);
+  for (int i=0; i<m_num_fields; ++i) {
+    const auto& f  = m_src_fields[i];
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    const auto& ap = f.get_header().get_alloc_properties();
+    const bool masked = m_field_idx_to_mask_idx[i]>0;
+    if (masked or fl.rank()>4 or ap.get_padding()>0 or
+        not f.get_header().get_parent().expired()) {
+      continue;
+    }
+    auto& fields = col_size2fields[fl.strip_dim(COL).size()];
+    if (fields.size()==0 or m_mat_vec_batches[fields.back()].size()==s_max_batch_size) {
+      fields.push_back(m_mat_vec_batches.size());
+      m_mat_vec_batches.emplace_back();
+    }
+    m_mat_vec_batches[fields.back()].push_back(i);
+    m_is_batched[i] = true;
+  }
+  m_mat_vec_batches_set = true;
+}
+
+void CoarseningRemapper::
+local_mat_vec_and_pack (const std::vector<int>& batch) const
+{
+  using MemberType  = typename KT::MemberType;
+  using ESU         = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+  using namespace ShortFieldTagsNames;
+
+  // All fields in the batch have the same amount of data per column
+  const int nfields = batch.size();
+  const int col_size = m_src_fields[batch[0]].get_header().get_identifier().get_layout().strip_dim(COL).size();
+  Kokkos::Array<const Real*,s_max_batch_size> x_data;
+  Kokkos::Array<int,s_max_batch_size> f_idx;
+  for (int ib=0; ib<nfields; ++ib) {
+    x_data[ib] = m_src_fields[batch[ib]].get_internal_view_data<const Real>();
+    f_idx[ib]  = batch[ib];
+  }
+
+  const int nrows = m_ov_coarse_grid->get_num_local_dofs();
+  auto row_offsets = m_row_offsets;
+  auto col_lids = m_col_lids;
+  auto weights = m_weights;
+  const auto pid_lid_start = m_send_pid_lids_start;
+  const auto lids_pids = m_send_lids_pids;
+  const auto lid_pos = m_send_lid_pos;
+  const auto f_pid_offsets = m_send_f_pid_offsets;
+  const auto buf = m_send_buffer;
+
+  // Each team reads the row of the matrix once, and uses it for all fields.
+  // The result goes where pack_and_send would put the overlapped fields data.
+  auto policy = ESU::get_default_team_policy(nrows,nfields*col_size);
+  Kokkos::parallel_for(policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const int row = team.league_rank();
+
+    const auto beg = row_offsets(row);
+    const auto end = row_offsets(row+1);
+    const int pos = lid_pos(row);
+    const int pid = lids_pids(pos,1);
+    const int lidpos = pos - pid_lid_start(pid);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nfields*col_size),
+                        [&](const int idx){
+      const int ib = idx / col_size;
+      const int k  = idx % col_size;
+      const Real* x = x_data[ib];
+      Real y = weights(beg)*x[col_lids(beg)*col_size+k];
+      for (int icol=beg+1; icol<end; ++icol) {
+        y += weights(icol)*x[col_lids(icol)*col_size+k];
+      }
+      buf(f_pid_offsets(f_idx[ib],pid) + lidpos*col_size + k) = y;
+    });
+  });
+}
+
 void CoarseningRemapper::pack_and_send ()
 {
   using RangePolicy = typename KT::RangePolicy;
@@ -576,6 +673,10 @@ void CoarseningRemapper::pack_and_send ()
   const auto buf = m_send_buffer;
 
   for (int ifield=0; ifield<m_num_fields; ++ifield) {
+    if (m_is_batched[ifield]) {
+      // Already in the send buffer
+      continue;
+    }
     const auto& f  = m_ov_fields[ifield];
     const auto& fl = f.get_header().get_identifier().get_layout();
     const auto f_pid_offsets = ekat::subview(m_send_f_pid_offsets,ifield);
@@ -818,95 +919,65 @@ void CoarseningRemapper::recv_and_unpack ()
   }
 }
 
-std::vector<int>
-CoarseningRemapper::get_pids_for_recv (const std::vector<int>& send_to_pids) const
-{
-  // Figure out how many sends each PID is doing
-  std::vector<int> num_sends(m_comm.size(),0);
-  num_sends[m_comm.rank()] = send_to_pids.size();
-  m_comm.all_gather(num_sends.data(),1);
-
-  // Offsets for send_pids coming from each pid
-  // NOTE: the extra entry at the end if for ease of use later
-  std::vector<int> sends_offsets (m_comm.size()+1,0);
-  for (int pid=1; pid<=m_comm.size(); ++pid) {
-    sends_offsets[pid] = sends_offsets[pid-1] + num_sends[pid-1];
-  }
-
-  // Gather all the pids that each rank is sending data to
-  auto nglobal_sends = std::accumulate(num_sends.begin(),num_sends.end(),0);
-  std::vector<int> global_send_pids(nglobal_sends,-1);
-  MPI_Allgatherv (send_to_pids.data(),send_to_pids.size(),MPI_INT,
-                  global_send_pids.data(),num_sends.data(),sends_offsets.data(),
-                  MPI_INT, m_comm.mpi_comm());
-
-  // Loop over all the ranks, and all the pids they send to, and look for my pid
-  std::vector<int> recv_from_pids;
-  for (int pid=0; pid<m_comm.size(); ++pid) {
-    const int beg = sends_offsets[pid];
-    const int end = sends_offsets[pid+1];
-
-    for (int i=beg; i<end; ++i) {
-      if (global_send_pids[i]==m_comm.rank()) {
-        recv_from_pids.push_back(pid);
-        break;
-      }
-    }
-  }
-
-  return recv_from_pids;
-}
-
 std::map<int,std::vector<int>>
 CoarseningRemapper::
 recv_gids_from_pids (const std::map<int,std::vector<int>>& pid2gids_send) const
 {
-  const auto comm = m_comm.mpi_comm();
-
-  // First, figure out which PIDs I need to recv from
-  std::vector<int> send_to;
-  for (const auto& it : pid2gids_send) {
-    send_to.push_back(it.first);
-  }
-  auto recv_from = get_pids_for_recv (send_to);
-
-  // Send num of lids send to each send_pid, and recv num of lids
-  // recv from each recv_pid
-  std::map<int,int> nsends, nrecvs;
-  std::vector<MPI_Request> send_req, recv_req;
+  // We don't know which pids will send to us (nor how much), and we want to avoid
+  // any O(num_ranks) collective/storage. We use the non-blocking consensus
+  // algorithm (Hoefler et al., "Scalable communication protocols for dynamic
+  // sparse data exchange", 2010):
+  //  - post a synchronous send to each pid we need to send gids to;
+  //  - probe for incoming msgs from any source, and recv them as they arrive;
+  //  - once all our sends completed (i.e., they have been matched by a recv),
+  //    enter a non-blocking barrier, and keep probing until the barrier completes.
+  // When the barrier completes, all msgs in the comm have been received.
+  // We work on a duplicate of the comm, so that msgs of this exchange cannot be
+  // mixed with other msgs (including the ones of a following call of this method,
+  // which a rank may start before the others have exited the probing loop).
+  MPI_Comm comm;
+  MPI_Comm_dup (m_comm.mpi_comm(),&comm);
+
+  std::vector<MPI_Request> send_req;
   for (const auto& it : pid2gids_send) {
-    const int pid = it.first;
-    nsends[pid] = it.second.size();
     send_req.emplace_back();
-    MPI_Isend (&nsends[pid],1,MPI_INT,pid,0,comm,&send_req.back());
-  }
-  for (auto pid : recv_from) {
-    recv_req.emplace_back();
-    MPI_Irecv(&nrecvs[pid],1,MPI_INT,pid,0,comm,&recv_req.back());
+    MPI_Issend(it.second.data(),it.second.size(),MPI_INT,
+               it.first,0,comm,&send_req.back());
   }
-  MPI_Waitall(send_req.size(),send_req.data(),MPI_STATUSES_IGNORE);
-  MPI_Waitall(recv_req.size(),recv_req.data(),MPI_STATUSES_IGNORE);
 
-  send_req.resize(0);
-  recv_req.resize(0);
-
-  // Now that we know how many gids we will get from each pid, we can send/recv them
-  for (const auto& it : pid2gids_send) {
-    send_req.emplace_back();
-    MPI_Isend(it.second.data(),it.second.size(),MPI_INT,
-              it.first,0,comm,&send_req.back());
-  }
   std::map<int,std::vector<int>> pid2gids_recv;
-  for (const auto& it : nrecvs) {
-    const int pid = it.first;
-    const int n   = it.second;
-    pid2gids_recv[pid].resize(n);
-    recv_req.emplace_back();
-    MPI_Irecv(pid2gids_recv[pid].data(),n,MPI_INT,
-              pid,0,comm,&recv_req.back());
+  MPI_Request barrier_req;
+  bool barrier_active = false;
+  while (true) {
+    // Recv any incoming msg
+    int has_msg;
+    MPI_Status status;
+    MPI_Iprobe(MPI_ANY_SOURCE,0,comm,&has_msg,&status);
+    if (has_msg) {
+      int n;
+      MPI_Get_count(&status,MPI_INT,&n);
+      auto& gids = pid2gids_recv[status.MPI_SOURCE];
+      gids.resize(n);
+      MPI_Recv(gids.data(),n,MPI_INT,status.MPI_SOURCE,0,comm,MPI_STATUS_IGNORE);
+    }
+
+    if (barrier_active) {
+      int barrier_done;
+      MPI_Test(&barrier_req,&barrier_done,MPI_STATUS_IGNORE);
+      if (barrier_done) {
+        break;
+      }
+    } else {
+      int sends_done;
+      MPI_Testall(send_req.size(),send_req.data(),&sends_done,MPI_STATUSES_IGNORE);
+      if (sends_done) {
+        MPI_Ibarrier(comm,&barrier_req);
+        barrier_active = true;
+      }
+    }
   }
-  MPI_Waitall(send_req.size(),send_req.data(),MPI_STATUSES_IGNORE);
-  MPI_Waitall(recv_req.size(),recv_req.data(),MPI_STATUSES_IGNORE);
+
+  MPI_Comm_free (&comm);
 
   return pid2gids_recv;
 }
@@ -964,6 +1035,17 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   Kokkos::deep_copy(m_send_lids_pids,send_lids_pids_h);
   Kokkos::deep_copy(m_send_pid_lids_start,send_pid_lids_start_h);
 
+  m_send_lid_pos = view_1d<int>("",num_ov_gids);
+  auto send_lid_pos_h = Kokkos::create_mirror_view(m_send_lid_pos);
+  for (int pos=0; pos<num_ov_gids; ++pos) {
+    send_lid_pos_h(send_lids_pids_h(pos,0)) = pos;
+  }
+  Kokkos::deep_copy(m_send_lid_pos,send_lid_pos_h);
+
+  // Fields may have changed, so batches must be recomputed
+  m_mat_vec_batches.clear();
+  m_mat_vec_batches_set = false;
+
   // 3. Compute offsets in send buffer for each pid/field pair
   m_send_f_pid_offsets = view_2d<int>("",m_num_fields,m_comm.size());
   auto send_f_pid_offsets_h = Kokkos::create_mirror_view(m_send_f_pid_offsets);
@@ -1114,11 +1196,15 @@ void CoarseningRemapper::clean_up ()
   m_recv_f_pid_offsets  = view_2d<int>();
   m_send_lids_pids      = view_2d<int>();
   m_send_pid_lids_start = view_1d<int>();
+  m_send_lid_pos        = view_1d<int>();
   m_recv_lids_pidpos    = view_2d<int>();
   m_recv_lids_beg       = view_1d<int>();
   m_recv_lids_end       = view_1d<int>();
   m_send_req.clear();
   m_recv_req.clear();
+  m_mat_vec_batches.clear();
+  m_is_batched.clear();
+  m_mat_vec_batches_set = false;
 
   HorizInterpRemapperBase::clean_up();
 }
@@ -36,6 +36,11 @@ namespace scream
  * The setup as well as the runtime operations use classic send/recv
  * MPI calls, where data is packed in a buffer and sent to the recv rank,
  * where it is then unpacked and accumulated into the result.
+ *
+ * Unmasked fields with contiguous storage are processed in batches of fields
+ * with the same amount of data per column: a single kernel does the mat-vec for
+ * all fields in the batch, reading the matrix once, and writes the result directly
+ * in the send buffer, skipping the intermediate fields.
  */
 
 class CoarseningRemapper : public HorizInterpRemapperBase
@@ -62,8 +67,6 @@ protected:
 
   void setup_mpi_data_structures () override;
 
-  std::vector<int> get_pids_for_recv (const std::vector<int>& send_to_pids) const;
-
   std::map<int,std::vector<int>>
   recv_gids_from_pids (const std::map<int,std::vector<int>>& pid2gids_send) const;
 
@@ -79,6 +82,7 @@ public:
   void local_mat_vec (const Field& f_src, const Field& f_tgt, const Field& mask) const;
   template<int N>
   void rescale_masked_fields (const Field& f_tgt, const Field& f_mask) const;
+  void local_mat_vec_and_pack (const std::vector<int>& batch) const;
   void pack_and_send ();
   void recv_and_unpack ();
   // Overload, not hide
@@ -100,6 +104,14 @@ protected:
   bool                  m_track_mask;
   std::map<int,int>     m_field_idx_to_mask_idx;
 
+  // Batches of fields for local_mat_vec_and_pack, and whether each field belongs
+  // to one. They are set at the first remap, once all masks are known.
+  static constexpr int  s_max_batch_size = 16;
+  void setup_mat_vec_batches ();
+  std::vector<std::vector<int>> m_mat_vec_batches;
+  std::vector<bool>             m_is_batched;
+  bool                          m_mat_vec_batches_set = false;
+
   // ------- MPI data structures -------- //
 
   // The send/recv buf for pack/unpack
@@ -128,6 +140,9 @@ protected:
   // Store the start of lids to send to each PID in the view above
   view_1d<int>          m_send_pid_lids_start;
 
+  // The inverse of the above: lids_pids(send_lid_pos(lid),0)=lid
+  view_1d<int>          m_send_lid_pos;
+
   // Unlike the packing for sends, unpacking after the recv can cause
   // race conditions. Hence, we ||ize of tgt lids, and process separate
   // contributions from separate PIDs serially. To do so, we use the
@@ -6,6 +6,7 @@
 #include <ekat/kokkos/ekat_kokkos_utils.hpp>
 #include <ekat/ekat_pack_utils.hpp>
 
+#include <map>
 #include <numeric>
 
 namespace scream
@@ -13,8 +14,10 @@ namespace scream
 
 RefiningRemapperRMA::
 RefiningRemapperRMA (const grid_ptr_type& tgt_grid,
-                     const std::string& map_file)
+                     const std::string& map_file,
+                     const bool aggregate_gets)
  : HorizInterpRemapperBase(tgt_grid,map_file,InterpType::Refine)
+ , m_aggregate_gets(aggregate_gets)
 {
   // Nothing to do here
 }
@@ -27,8 +30,21 @@ RefiningRemapperRMA::
 
 void RefiningRemapperRMA::do_remap_fwd ()
 {
-  // Start RMA epoch on each field
-  for (int i=0; i<m_num_fields; ++i) {
+  if (m_aggregate_gets) {
+    // One epoch, and one get per remote pid
+    check_mpi_call(MPI_Win_post(m_mpi_group,0,m_agg_win),"MPI_Win_post");
+    check_mpi_call(MPI_Win_start(m_mpi_group,0,m_agg_win),"MPI_Win_start");
+    for (size_t k=0; k<m_agg_pids.size(); ++k) {
+      check_mpi_call(MPI_Get(MPI_BOTTOM,1,m_agg_origin_types[k],m_agg_pids[k],
+                             0,1,m_agg_target_types[k],m_agg_win),
+                     "MPI_Get from pid " + std::to_string(m_agg_pids[k]));
+    }
+    check_mpi_call(MPI_Win_complete(m_agg_win),"MPI_Win_complete");
+  }
+
+  // Start RMA epoch on each field (no per-field windows if gets are aggregated)
+  const int nwins = m_mpi_win.size();
+  for (int i=0; i<nwins; ++i) {
     check_mpi_call(MPI_Win_post(m_mpi_group,0,m_mpi_win[i]),
                    "MPI_Win_post for field: " + m_src_fields[i].name());
     check_mpi_call(MPI_Win_start(m_mpi_group,0,m_mpi_win[i]),
@@ -38,7 +54,7 @@ void RefiningRemapperRMA::do_remap_fwd ()
   // Loop over fields, and grab data
   constexpr HostOrDevice MpiDev = MpiOnDev ? Device : Host;
   const auto& dt = ekat::get_mpi_type<Real>();
-  for (int i=0; i<m_num_fields; ++i) {
+  for (int i=0; i<nwins; ++i) {
     const int col_size = m_col_size[i];
     const int col_stride = m_col_stride[i];
     const int col_offset = m_col_offset[i];
@@ -54,7 +70,7 @@ void RefiningRemapperRMA::do_remap_fwd ()
   }
 
   // Close access RMA epoch on each field (exposure is still open)
-  for (int i=0; i<m_num_fields; ++i) {
+  for (int i=0; i<nwins; ++i) {
     check_mpi_call(MPI_Win_complete(m_mpi_win[i]),
                    "MPI_Win_complete for field: " + m_ov_fields[i].name());
   }
@@ -90,10 +106,13 @@ void RefiningRemapperRMA::do_remap_fwd ()
   }
 
   // Close exposure RMA epoch on each field
-  for (int i=0; i<m_num_fields; ++i) {
+  for (int i=0; i<nwins; ++i) {
     check_mpi_call(MPI_Win_wait(m_mpi_win[i]),
                    "MPI_Win_post for field: " + m_src_fields[i].name());
   }
+  if (m_aggregate_gets) {
+    check_mpi_call(MPI_Win_wait(m_agg_win),"MPI_Win_wait");
+  }
 }
 
 void RefiningRemapperRMA::setup_mpi_data_structures ()
@@ -112,7 +131,7 @@ void RefiningRemapperRMA::setup_mpi_data_structures ()
   //       (but I'm afraid you can't, b/c start/post may require same groups)
 
   // Create per-field structures
-  m_mpi_win.resize(m_num_fields);
+  m_mpi_win.resize(m_aggregate_gets ? 0 : m_num_fields);
   m_col_size.resize(m_num_fields);
   m_col_stride.resize(m_num_fields);
   m_col_offset.resize(m_num_fields,0);
@@ -137,6 +156,10 @@ void RefiningRemapperRMA::setup_mpi_data_structures ()
       win_size *= sv_info.dim_extent;
     }
 
+    if (m_aggregate_gets) {
+      continue;
+    }
+
     auto data = f.get_internal_view_data<Real,Host>();
     check_mpi_call(MPI_Win_create(data,win_size,sizeof(Real),
                                   MPI_INFO_NULL,mpi_comm,&m_mpi_win[i]),
@@ -146,6 +169,102 @@ void RefiningRemapperRMA::setup_mpi_data_structures ()
                    "[RefiningRemapperRMA::setup_mpi_data_structure] setting MPI_ERRORS_RETURN handler on MPI_Win");
 #endif
   }
+
+  if (m_aggregate_gets) {
+    setup_aggregated_gets ();
+  }
+}
+
+void RefiningRemapperRMA::setup_aggregated_gets ()
+{
+  using namespace ShortFieldTagsNames;
+
+  const auto mpi_comm = m_comm.mpi_comm();
+  const int  nranks   = m_comm.size();
+  const int  nfields  = m_num_fields;
+  const auto& dt = ekat::get_mpi_type<Real>();
+
+  check_mpi_call(MPI_Win_create_dynamic(MPI_INFO_NULL,mpi_comm,&m_agg_win),
+                 "[RefiningRemapperRMA::setup_aggregated_gets] MPI_Win_create_dynamic");
+#ifndef EKAT_MPI_ERRORS_ARE_FATAL
+  check_mpi_call(MPI_Win_set_errhandler(m_agg_win,MPI_ERRORS_RETURN),
+                 "[RefiningRemapperRMA::setup_aggregated_gets] setting MPI_ERRORS_RETURN handler on MPI_Win");
+#endif
+
+  // Attach src fields data. Subfields of the same parent share the
+  // same memory, which must be attached only once.
+  std::map<Real*,MPI_Aint> regions;
+  std::vector<MPI_Aint> my_addr(nfields);
+  for (int i=0; i<nfields; ++i) {
+    const auto& f = m_src_fields[i];
+    const auto& fh = f.get_header();
+    const auto& layout = fh.get_identifier().get_layout();
+    MPI_Aint size = layout.dim(COL)*m_col_stride[i]*sizeof(Real);
+
+    auto data = f.get_internal_view_data<Real,Host>();
+    auto& r = regions[data];
+    r = std::max(r,size);
+    check_mpi_call(MPI_Get_address(data,&my_addr[i]),"MPI_Get_address");
+  }
+  for (const auto& it : regions) {
+    if (it.second==0) {
+      continue;
+    }
+    check_mpi_call(MPI_Win_attach(m_agg_win,it.first,it.second),
+                   "[RefiningRemapperRMA::setup_aggregated_gets] MPI_Win_attach");
+    m_agg_attached.push_back(it.first);
+  }
+
+  // Since windows are dynamic, target displacements are absolute addresses
+  // on the remote rank, so we need to know the address of all fields on all ranks.
+  std::vector<MPI_Aint> all_addr(nranks*nfields);
+  check_mpi_call(MPI_Allgather(my_addr.data(),nfields,MPI_AINT,
+                               all_addr.data(),nfields,MPI_AINT,mpi_comm),
+                 "[RefiningRemapperRMA::setup_aggregated_gets] MPI_Allgather");
+
+  // Group ov columns by owner
+  const int num_ov_cols = m_ov_coarse_grid->get_num_local_dofs();
+  std::map<int,std::vector<int>> pid2cols;
+  for (int icol=0; icol<num_ov_cols; ++icol) {
+    pid2cols[m_remote_pids[icol]].push_back(icol);
+  }
+
+  // For each remote pid, build origin/target types spanning all fields
+  std::vector<int> blocklens;
+  std::vector<MPI_Aint> origin_disp, target_disp;
+  for (const auto& it : pid2cols) {
+    const int pid = it.first;
+    const auto& cols = it.second;
+    blocklens.clear();
+    origin_disp.clear();
+    target_disp.clear();
+    for (int i=0; i<nfields; ++i) {
+      const int col_size = m_col_size[i];
+      auto ov_data = m_ov_fields[i].get_internal_view_data<Real,Host>();
+      for (int icol : cols) {
+        const int lid = m_remote_lids[icol];
+        MPI_Aint addr;
+        check_mpi_call(MPI_Get_address(ov_data+icol*col_size,&addr),"MPI_Get_address");
+        blocklens.push_back(col_size);
+        origin_disp.push_back(addr);
+        target_disp.push_back(all_addr[pid*nfields+i] +
+                              (lid*m_col_stride[i]+m_col_offset[i])*sizeof(Real));
+      }
+    }
+
+    const int nblocks = blocklens.size();
+    MPI_Datatype origin, target;
+    check_mpi_call(MPI_Type_create_hindexed(nblocks,blocklens.data(),origin_disp.data(),dt,&origin),
+                   "[RefiningRemapperRMA::setup_aggregated_gets] MPI_Type_create_hindexed");
+    check_mpi_call(MPI_Type_create_hindexed(nblocks,blocklens.data(),target_disp.data(),dt,&target),
+                   "[RefiningRemapperRMA::setup_aggregated_gets] MPI_Type_create_hindexed");
+    check_mpi_call(MPI_Type_commit(&origin),"MPI_Type_commit");
+    check_mpi_call(MPI_Type_commit(&target),"MPI_Type_commit");
+
+    m_agg_pids.push_back(pid);
+    m_agg_origin_types.push_back(origin);
+    m_agg_target_types.push_back(target);
+  }
 }
 
 void RefiningRemapperRMA::clean_up ()
@@ -159,6 +278,22 @@ void RefiningRemapperRMA::clean_up ()
     check_mpi_call(MPI_Win_free(&win),"MPI_Win_free");
   }
   m_mpi_win.clear();
+  for (auto& t : m_agg_origin_types) {
+    check_mpi_call(MPI_Type_free(&t),"MPI_Type_free");
+  }
+  for (auto& t : m_agg_target_types) {
+    check_mpi_call(MPI_Type_free(&t),"MPI_Type_free");
+  }
+  m_agg_origin_types.clear();
+  m_agg_target_types.clear();
+  m_agg_pids.clear();
+  if (m_agg_win!=MPI_WIN_NULL) {
+    for (auto data : m_agg_attached) {
+      check_mpi_call(MPI_Win_detach(m_agg_win,data),"MPI_Win_detach");
+    }
+    check_mpi_call(MPI_Win_free(&m_agg_win),"MPI_Win_free");
+  }
+  m_agg_attached.clear();
   m_remote_pids.clear();
   m_remote_lids.clear();
   m_col_size.clear();
@@ -42,6 +42,16 @@ namespace scream
  * standard since 2.0, but its support is still sub-optimal, due to
  * limited effort in optimizing it by the vendors. Furthermore, as of
  * Oct 2023, RMA operations are not supported by GPU-aware implementations.
+ *
+ * By default (aggregate_gets=true), all src fields are attached to a single
+ * dynamic window, and all the data coming from a given remote rank is
+ * described with one derived datatype (on both origin and target side),
+ * so that a single MPI_Get per remote rank is issued at each remap call.
+ * This greatly reduces the number of RMA operations (and epochs) when
+ * many small columns are retrieved. If aggregate_gets=false, each field is
+ * exposed via its own MPI window, and each overlapped column of each field
+ * is retrieved with its own MPI_Get (useful, e.g., with MPI implementations
+ * that do not handle dynamic windows well).
  */
 
 class RefiningRemapperRMA : public HorizInterpRemapperBase
@@ -49,7 +59,8 @@ class RefiningRemapperRMA : public HorizInterpRemapperBase
 public:
 
   RefiningRemapperRMA (const grid_ptr_type& tgt_grid,
-                       const std::string& map_file);
+                       const std::string& map_file,
+                       const bool aggregate_gets = true);
 
   ~RefiningRemapperRMA ();
 
@@ -61,6 +72,9 @@ protected:
 
   void setup_mpi_data_structures () override;
 
+  // Create the dynamic window and the per-remote-rank datatypes
+  void setup_aggregated_gets ();
+
   // This class uses itself to remap src grid geo data to the tgt grid. But in order
   // to not pollute the remapper for later use, we must be able to clean it up after
   // remapping all the geo data.
@@ -104,6 +118,21 @@ protected:
 
   // One MPI window object for each field
   std::vector<MPI_Win>      m_mpi_win;
+
+  // ------- Aggregated gets data structures -------- //
+
+  bool                      m_aggregate_gets;
+
+  // A dynamic window, where all src fields data is attached
+  MPI_Win                   m_agg_win = MPI_WIN_NULL;
+  std::vector<Real*>        m_agg_attached;
+
+  // For each remote pid we get data from, the datatypes describing
+  // where data lives in the ov fields (origin, absolute addresses)
+  // and in the remote src fields (target, remote absolute addresses)
+  std::vector<int>          m_agg_pids;
+  std::vector<MPI_Datatype> m_agg_origin_types;
+  std::vector<MPI_Datatype> m_agg_target_types;
 };
 
 } // namespace scream
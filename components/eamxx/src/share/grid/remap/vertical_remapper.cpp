@@ -170,6 +170,7 @@ set_pressure_levels(const std::string& map_file)
   scorpio::grid_read_data_array(map_file,"p_levs",-1,remap_pres_scal.data(),remap_pres_scal.size());
 
   m_remap_pres.sync_to_dev();
+  m_remap_pres_levs.assign(remap_pres_scal.data(),remap_pres_scal.data()+m_num_remap_levs);
 }
 
 void VerticalRemapper::
@@ -402,20 +403,26 @@ apply_vertical_interpolation(const Field& f_src, const Field& f_tgt, const bool
     src_lev_f = m_src_mid;
   }
   auto src_lev  = src_lev_f.get_view<const Pack**>();
-  auto remap_pres_view = m_remap_pres.get_view<Pack*>();
+
+  // All fields (and masks) on the same src profile share the bracket search
+  const auto plan = get_vertical_interpolation_plan<Packsize>(src_lev_f,m_remap_pres_levs);
+  EKAT_REQUIRE_MSG (plan->num_levs_src()==src_num_levs,
+      "Error! Field vertical extent does not match the one of the source pressure.\n"
+      " - field name: " + f_src.name() + "\n"
+      " - source pressure name: " + src_lev_f.name() + "\n");
   switch(rank) {
     case 2:
     {
       auto src_view = f_src.get_view<const Pack**>();
       auto tgt_view = f_tgt.get_view<      Pack**>();
-      perform_vertical_interpolation<Real,Packsize,2>(src_lev,remap_pres_view,src_view,tgt_view,src_num_levs,m_num_remap_levs,mask_val);
+      perform_vertical_interpolation<Real,Packsize,2>(src_lev,*plan,src_view,tgt_view,mask_val);
       break;
     }
     case 3:
     {
       auto src_view = f_src.get_view<const Pack***>();
       auto tgt_view = f_tgt.get_view<      Pack***>();
-      perform_vertical_interpolation<Real,Packsize,3>(src_lev,remap_pres_view,src_view,tgt_view,src_num_levs,m_num_remap_levs,mask_val);
+      perform_vertical_interpolation<Real,Packsize,3>(src_lev,*plan,src_view,tgt_view,mask_val);
       break;
     }
     default:
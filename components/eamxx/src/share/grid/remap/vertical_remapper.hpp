@@ -147,6 +147,7 @@ protected:
   int                   m_num_remap_levs;
   Real                  m_mask_val;
   Field                 m_remap_pres;
+  std::vector<Real>     m_remap_pres_levs;  // Host copy of m_remap_pres, to look up interp plans
   Field                 m_src_mid;  // Src vertical profile for LEV layouts
   Field                 m_src_int;  // Src vertical profile for ILEV layouts
   bool                  m_mid_set = false;
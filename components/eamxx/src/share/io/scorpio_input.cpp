@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <numeric>
+#include <vector>
 
 namespace scream
 {
@@ -216,11 +217,23 @@ void AtmosphereInput::read_variables (const int time_index)
   EKAT_REQUIRE_MSG (m_inited_with_views || m_inited_with_fields,
       "Error! Scorpio structures not inited yet. Did you forget to call 'init(..)'?\n");
 
+  // If the data was prefetched, wait for the read to complete (if needed).
+  // If we prefetched a different time slice, the staged data is simply discarded.
+  const bool use_prefetch = m_has_prefetch && m_prefetch_time_index==time_index;
+  if (m_has_prefetch) {
+    scorpio::wait_for_pending_io_tasks(m_filename);
+    m_has_prefetch = false;
+  }
+
   for (auto const& name : m_fields_names) {
 
-    // Read the data
+    // Read the data (or grab it from the staging buffer)
     auto v1d = m_host_views_1d.at(name);
-    scorpio::grid_read_data_array(m_filename,name,time_index,v1d.data(),v1d.size());
+    if (use_prefetch) {
+      Kokkos::deep_copy(v1d,m_prefetch_views_1d.at(name));
+    } else {
+      scorpio::grid_read_data_array(m_filename,name,time_index,v1d.data(),v1d.size());
+    }
 
     // If we have a field manager, make sure the data is correctly
     // synced to both host and device views of the field.
@@ -332,11 +345,72 @@ void AtmosphereInput::read_variables (const int time_index)
   }
 } 
 
+/* ---------------------------------------------------------- */
+void AtmosphereInput::prefetch_variables (const int time_index)
+{
+  EKAT_REQUIRE_MSG (m_inited_with_views || m_inited_with_fields,
+      "Error! Scorpio structures not inited yet. Did you forget to call 'init(..)'?\n");
+
+  if (not scorpio::async_io_supported()) {
+    return;
+  }
+
+  // Make sure a previous prefetch is done before we overwrite the staging buffers
+  if (m_has_prefetch) {
+    scorpio::wait_for_pending_io_tasks(m_filename);
+  }
+
+  if (m_atm_logger) {
+    m_atm_logger->info("[EAMxx::scorpio_input] Prefetching variables from file");
+    m_atm_logger->info("  file name: " + m_filename);
+    if (time_index!=-1) {
+      m_atm_logger->info("  time idx : " + std::to_string(time_index));
+    }
+  }
+
+  // The staging buffers can't alias the field views, since the read
+  // happens while the model is still using the current field values.
+  for (auto const& name : m_fields_names) {
+    if (m_prefetch_views_1d.count(name)==0) {
+      const auto size = m_host_views_1d.at(name).size();
+      m_prefetch_views_1d[name] = view_1d_host("prefetch_"+name,size);
+    }
+  }
+
+  // The I/O thread must not touch Kokkos objects or the logger, so only
+  // pass raw pointers to the task. The staging buffers outlive the task,
+  // since we wait for pending tasks before clearing them.
+  struct StagingBuffer {
+    std::string name;
+    Real*       data;
+    int         size;
+  };
+  std::vector<StagingBuffer> buffers;
+  for (auto const& name : m_fields_names) {
+    auto v1d = m_prefetch_views_1d.at(name);
+    buffers.push_back({name,v1d.data(),static_cast<int>(v1d.size())});
+  }
+  const auto filename = m_filename;
+  auto read_task = [filename,buffers,time_index]() {
+    for (const auto& b : buffers) {
+      scorpio::grid_read_data_array(filename,b.name,time_index,b.data,b.size);
+    }
+  };
+  scorpio::enqueue_io_task(filename,read_task);
+
+  m_prefetch_time_index = time_index;
+  m_has_prefetch = true;
+}
+
 /* ---------------------------------------------------------- */
 void AtmosphereInput::finalize() 
 {
   scorpio::eam_pio_closefile(m_filename);
 
+  // Note: eam_pio_closefile waits for pending I/O tasks, including any prefetch
+  m_prefetch_views_1d.clear();
+  m_has_prefetch = false;
+
   m_field_mgr = nullptr;
   m_io_grid   = nullptr;
 
@@ -102,6 +102,14 @@ public:
   // Read fields that were required via parameter list.
   void read_variables (const int time_index = -1);
 
+  // Start reading the fields at the given time index in the background, into
+  // internal staging buffers. A later call to read_variables with the same
+  // time index only needs to copy the data out of the staging buffers (after
+  // waiting for the read to complete, if it has not yet), and does no I/O.
+  // If async I/O is not supported, this is a no-op, and read_variables will
+  // simply read from file.
+  void prefetch_variables (const int time_index = -1);
+
   // Cleans up the class
   void finalize();
 
@@ -145,6 +153,11 @@ protected:
   bool m_inited_with_fields        = false;
   bool m_inited_with_views         = false;
 
+  // Staging buffers for prefetched data
+  std::map<std::string, view_1d_host>   m_prefetch_views_1d;
+  int  m_prefetch_time_index       = -1;
+  bool m_has_prefetch              = false;
+
   // The logger to be used throughout the ATM to log message
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
 }; // Class AtmosphereInput
@@ -12,6 +12,7 @@
 
 #include <numeric>
 #include <fstream>
+#include <sstream>
 
 namespace scream
 {
@@ -80,6 +81,43 @@ void sort_and_check(std::vector<std::string>& fields)
   EKAT_REQUIRE_MSG(!hasDuplicates,"ERROR!!! scorpio_output::check_for_duplicates - One of the output yaml files has duplicate field entries.  Please check");
 }
 
+OutputDiagnosticsRegistry::diag_ptr_type
+OutputDiagnosticsRegistry::get (const std::string& key) const
+{
+  auto it = m_entries.find(key);
+  return it==m_entries.end() ? nullptr : it->second.diag;
+}
+
+void OutputDiagnosticsRegistry::
+add (const std::string& key, const diag_ptr_type& diag)
+{
+  EKAT_REQUIRE_MSG (m_entries.count(key)==0,
+      "Error! A diagnostic with key '" + key + "' was already registered.\n");
+  m_entries[key].diag = diag;
+}
+
+bool OutputDiagnosticsRegistry::
+check_and_set_computed (const std::string& key, const bool allow_invalid_fields)
+{
+  auto& e = m_entries.at(key);
+
+  // The diag would get the most recent timestamp among the inputs
+  util::TimeStamp ts;
+  for (const auto& f : e.diag->get_fields_in()) {
+    const auto& fts = f.get_header().get_tracking().get_time_stamp();
+    if (not ts.is_valid() || ts<fts) {
+      ts = fts;
+    }
+  }
+
+  if (ts.is_valid() and ts==e.computed_ts and allow_invalid_fields==e.computed_allow_invalid) {
+    return true;
+  }
+  e.computed_ts = ts;
+  e.computed_allow_invalid = allow_invalid_fields;
+  return false;
+}
+
 AtmosphereOutput::
 AtmosphereOutput (const ekat::Comm& comm,
                   const std::vector<Field>& fields,
@@ -113,9 +151,11 @@ AtmosphereOutput (const ekat::Comm& comm,
 AtmosphereOutput::
 AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
                   const std::shared_ptr<const fm_type>& field_mgr,
-                  const std::shared_ptr<const gm_type>& grids_mgr)
- : m_comm         (comm)
- , m_add_time_dim (true)
+                  const std::shared_ptr<const gm_type>& grids_mgr,
+                  const std::shared_ptr<OutputDiagnosticsRegistry>& diags_registry)
+ : m_comm           (comm)
+ , m_diags_registry (diags_registry ? diags_registry : std::make_shared<OutputDiagnosticsRegistry>())
+ , m_add_time_dim   (true)
 {
   using vos_t = std::vector<std::string>;
 
@@ -210,6 +250,10 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
   if (params.isParameter("fill_threshold")) {
     m_avg_coeff_threshold = params.get<Real>("fill_threshold");
   }
+  m_async_write = params.get("async_write",false);
+  EKAT_REQUIRE_MSG (not m_async_write or scorpio::async_io_supported(),
+      "Error! Asynchronous output requires MPI to be initialized with MPI_THREAD_MULTIPLE.\n"
+      " - filename prefix: " + params.get<std::string>("filename_prefix","") + "\n");
 
   // Helper lambda, to copy io string attributes. This will be used if any
   // remapper is created, to ensure atts set by atm_procs are not lost
@@ -307,13 +351,34 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
       transfer_io_str_atts (src,tgt);
     }
 
-    // Register all output fields in the remapper.
+    // For Average output, a linear remap commutes with the time average, so we can
+    // accumulate on the source grid, and remap only on write steps. This requires that
+    // nothing is masked, since the masked remap rescales by the remapped mask.
+    // Since the sums are done in a different order, the output is not BFB with the
+    // per-step remap, so this is opt-in, via the "defer_horiz_remap" option.
+    m_defer_horiz_remap = params.get("defer_horiz_remap",false) and
+                          use_horiz_remap_from_file and not use_vertical_remap_from_file and
+                          m_avg_type==OutputAvgType::Average and not m_track_avg_cnt;
+    for (const auto& fname : m_fields_names) {
+      const auto& hdr = get_field(fname,"before_horizontal_remap").get_header();
+      if (hdr.has_extra_data("mask_data") or hdr.has_extra_data("mask_value")) {
+        m_defer_horiz_remap = false;
+      }
+    }
+
+    // Register all output fields in the remapper. If the remap is deferred, the remapper
+    // source fields are the running sums on the source grid.
     m_horiz_remapper->registration_begins();
     for (const auto& fname : m_fields_names) {
-      const auto src = get_field(fname,"before_horizontal_remap");
+      auto src = get_field(fname,"before_horizontal_remap");
       const auto tgt = io_fm->get_field(src.name());
       EKAT_REQUIRE_MSG(src.data_type()==DataType::RealType,
           "Error! I/O supports only Real data, for now.\n");
+      if (m_defer_horiz_remap) {
+        src = src.clone();
+        src.deep_copy(0);
+        m_horiz_remap_accum_fields.emplace(fname,src);
+      }
       m_horiz_remapper->register_field(src,tgt);
     }
     m_horiz_remapper->registration_ends();
@@ -379,6 +444,14 @@ run (const std::string& filename,
       m_atm_logger->info("[EAMxx::scorpio_output] Writing variables to file");
       m_atm_logger->info("  file name: " + filename);
     }
+    if (m_async_write) {
+      // The host views are the staging buffers of the previous async write,
+      // so make sure that write is done before we overwrite them. Notice that
+      // the previous write may have been on another file.
+      if (m_last_async_filename!="") {
+        scorpio::wait_for_pending_io_tasks(m_last_async_filename);
+      }
+    }
   }
 
   using namespace scream::scorpio;
@@ -391,6 +464,28 @@ run (const std::string& filename,
     compute_diagnostic(it.first,allow_invalid_fields);
   }
 
+  // If the horizontal remap is deferred, add this step's values to the running sums
+  // on the source grid. Unless we need to write, there's nothing else to do.
+  // NOTE: all fields must be valid at every step. A field skipped at some step would
+  //       still be divided by nsteps_since_last_output, biasing its average low. This
+  //       is not a restriction in practice: Average streams have a time dimension, and
+  //       do not write at t0, so they never run with allow_invalid_fields=true.
+  if (m_defer_horiz_remap) {
+    for (const auto& name : m_fields_names) {
+      const auto src = get_field(name,"before_horizontal_remap");
+      const auto& src_t = src.get_header().get_tracking().get_time_stamp();
+      EKAT_REQUIRE_MSG (src_t.is_valid(),
+          "Error! Output field '" + name + "' has not been initialized yet.\n"
+          "       Averaged output with deferred horizontal remap requires valid fields at every step.\n");
+      auto& accum = m_horiz_remap_accum_fields.at(name);
+      accum.update(src,Real(1),Real(1));
+      accum.get_header().get_tracking().update_time_stamp(src_t);
+    }
+    if (not is_write_step) {
+      return;
+    }
+  }
+
   auto apply_remap = [&](const std::shared_ptr<AbstractRemapper> remapper)
   {
     remapper->remap(true);
@@ -419,6 +514,12 @@ run (const std::string& filename,
     stop_timer("EAMxx::IO::horiz_remap");
   }
 
+  // The remapped sums are added to the running tallies on the io grid below, which
+  // also hold any partial sums read from a history restart file.
+  for (auto& it : m_horiz_remap_accum_fields) {
+    it.second.deep_copy(0);
+  }
+
   // Update all of the averaging count views (if needed)
   // The strategy is as follows:
   // For the update to the averaged value for this timestep we need to track if
@@ -475,7 +576,7 @@ run (const std::string& filename,
 
     const bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
     const bool is_aliasing_field_view =
-        m_avg_type==OutputAvgType::Instant &&
+        m_avg_type==OutputAvgType::Instant && not m_async_write &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent().expired() &&
         not is_diagnostic;
@@ -612,6 +713,10 @@ run (const std::string& filename,
       // Bring data to host
       auto view_host = m_host_views_1d.at(name);
       Kokkos::deep_copy (view_host,view_dev);
+      if (m_async_write) {
+        // The actual write is done later by the I/O thread
+        continue;
+      }
       auto func_start = std::chrono::steady_clock::now();
       grid_write_data_array(filename,name,view_host.data(),view_host.size());
       auto func_finish = std::chrono::steady_clock::now();
@@ -626,6 +731,9 @@ run (const std::string& filename,
       // Bring data to host
       auto view_host = m_host_views_1d.at(name);
       Kokkos::deep_copy (view_host,view_dev);
+      if (m_async_write) {
+        continue;
+      }
       auto func_start = std::chrono::steady_clock::now();
       grid_write_data_array(filename,name,view_host.data(),view_host.size());
       auto func_finish = std::chrono::steady_clock::now();
@@ -633,7 +741,28 @@ run (const std::string& filename,
       duration_write += duration_loc.count();
     }
   }
-  if (is_write_step) {
+  if (is_write_step and m_async_write) {
+    // The host views now hold a snapshot of the output data, which is not
+    // touched until the next write step. Hand the writes to the I/O thread,
+    // so that the model can proceed with the next time step.
+    std::vector<std::pair<std::string,view_1d_host>> staged;
+    for (const auto& name : m_fields_names) {
+      staged.emplace_back(name,m_host_views_1d.at(name));
+    }
+    for (const auto& name : m_avg_cnt_names) {
+      staged.emplace_back(name,m_host_views_1d.at(name));
+    }
+    m_last_async_filename = filename;
+    scorpio::enqueue_io_task(filename,[filename,staged]() {
+      for (const auto& it : staged) {
+        const auto& v = it.second;
+        scorpio::grid_write_data_array(filename,it.first,v.data(),v.size());
+      }
+    });
+    if (m_atm_logger) {
+      m_atm_logger->info("  Done! Writes handed over to the I/O thread.");
+    }
+  } else if (is_write_step) {
     if (m_atm_logger) {
       m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration_write/1000.0) +" seconds");
     }
@@ -672,7 +801,7 @@ res_dep_memory_footprint () const {
   for (const auto& fn : m_fields_names) {
     bool is_diagnostic = (m_diagnostics.find(fn) != m_diagnostics.end());
     bool can_alias_field_view =
-        m_avg_type==OutputAvgType::Instant && not is_diagnostic &&
+        m_avg_type==OutputAvgType::Instant && not is_diagnostic && not m_async_write &&
         io_field_mgr->get_field(fn).get_header().get_alloc_properties().get_padding()==0 &&
         io_field_mgr->get_field(fn).get_header().get_parent().expired();
 
@@ -800,8 +929,11 @@ void AtmosphereOutput::register_views()
     //
     // We also don't want to alias to a diagnostic output since it could share memory
     // with another diagnostic.
+    //
+    // With async writes, the host views are the staging buffer for the I/O thread,
+    // so they must not alias the field data, which the model keeps updating.
     bool can_alias_field_view =
-        m_avg_type==OutputAvgType::Instant &&
+        m_avg_type==OutputAvgType::Instant && not m_async_write &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent().expired() &&
         not is_diagnostic;
@@ -1172,6 +1304,13 @@ compute_diagnostic(const std::string& name, const bool allow_invalid_fields)
   }
 
   m_diag_computed[name] = true;
+
+  // The diag may be shared with other streams, which may have already
+  // computed it for the current inputs.
+  if (m_diags_registry->check_and_set_computed(m_diag_registry_keys.at(name),allow_invalid_fields)) {
+    return;
+  }
+
   if (allow_invalid_fields) {
     // If any input is invalid, fill the diagnostic with invalid data
     for (auto f : diag->get_fields_in()) {
@@ -1336,15 +1475,25 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
     params.set<std::string>("diag_name", diag_name);
   }
 
+  // Diags computed from the same field manager with the same fill value can be
+  // shared with other streams. If another stream already created it, reuse it.
+  const auto sim_field_mgr = get_field_manager("sim");
+  std::stringstream key;
+  key << sim_field_mgr.get() << "|" << std::hexfloat << m_fill_value << "|" << diag_field_name;
+  auto diag = m_diags_registry->get(key.str());
+  const bool is_new = diag==nullptr;
+
   // Create the diagnostic
-  auto diag = diag_factory.create(diag_name,m_comm,params);
-  diag->set_grids(m_grids_manager);
+  if (is_new) {
+    diag = diag_factory.create(diag_name,m_comm,params);
+    diag->set_grids(m_grids_manager);
+    m_diags_registry->add(key.str(),diag);
+  }
 
   // Add empty entry for this map, so .at(..) always works
   auto& deps = m_diag_depends_on_diags[diag->name()];
 
   // Initialize the diagnostic
-  const auto sim_field_mgr = get_field_manager("sim");
   for (const auto& freq : diag->get_required_field_requests()) {
     const auto& fname = freq.fid.name();
     if (!sim_field_mgr->has_field(fname)) {
@@ -1355,9 +1504,14 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
       auto dep = m_diagnostics.at(fname);
       deps.push_back(fname);
     }
-    diag->set_required_field (get_field(fname,"sim"));
+    if (is_new) {
+      diag->set_required_field (get_field(fname,"sim"));
+    }
+  }
+  if (is_new) {
+    diag->initialize(util::TimeStamp(),RunType::Initial);
   }
-  diag->initialize(util::TimeStamp(),RunType::Initial);
+  m_diag_registry_keys[diag->get_diagnostic().name()] = key.str();
   // If specified, set avg_cnt tracking for this diagnostic.
   if (m_track_avg_cnt) {
     const auto diag_field = diag->get_diagnostic();
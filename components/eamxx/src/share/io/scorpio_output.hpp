@@ -28,6 +28,8 @@
  *  filename_prefix:              STRING
  *  Averaging Type:               STRING
  *  Max Snapshots Per File:       INT                   (default: 1)
+ *  async_write:                  BOOL                  (default: false)
+ *  defer_horiz_remap:            BOOL                  (default: false)
  *  Fields:
  *     GRID_NAME_1:
  *        Field Names:            ARRAY OF STRINGS
@@ -62,6 +64,11 @@
  *                        SEGrid fields to PointGrid fields on the fly, to save on output size)
  *  - Max Snapshots Per File: the maximum number of snapshots saved per file. After this many
  *    snapshots, the current files is closed and a new file created.
+ *  - async_write: if true, on write steps the output data is copied to host staging buffers, and
+ *    the actual writes are done by a background I/O thread, so the model can proceed with the
+ *    next time step. Requires MPI_THREAD_MULTIPLE.
+ *  - defer_horiz_remap: if true, and the stream allows it (see Notes below), the horizontal
+ *    remap is done only on write steps. The output is not BFB with the per-step remap.
  *  - Output: parameters for output control
  *    - Frequency: the frequency of output writes (in the units specified by ${Output frequency_units})
  *    - frequency_units: the units of output frequency (nsteps, nmonths, nyears, nhours, ndays,...)
@@ -93,6 +100,10 @@
  *     you will need one instance per grid.
  *   - usage of this class is to create an output file, write data to the file and close the file.
  *   - this class keeps a temp array for all output fields to be used to perform averaging.
+ *   - for Average output with a horizontal remap from file, no vertical remap, and no masked
+ *     fields, the remap commutes with the time average. In that case, if defer_horiz_remap=true,
+ *     the running sum is accumulated on the source grid, and remapped only on write steps. All fields
+ *     must then be valid at every step, since a skipped step would bias the average.
  * --------------------------------------------------------------------------------
  *  (2020-10-21) Aaron S. Donahue (LLNL)
  *  (2021-08-19) Luca Bertagna (SNL)
@@ -103,6 +114,34 @@
 namespace scream
 {
 
+/*  A registry of the diagnostics created by output streams. Streams sharing the same registry
+ *  (possibly belonging to different OutputManager's) share a diagnostic if they request it
+ *  on the same grid with the same fill value, so that it is created once, and computed at
+ *  most once for each time stamp of its inputs.
+ */
+class OutputDiagnosticsRegistry
+{
+public:
+  using diag_ptr_type = std::shared_ptr<AtmosphereDiagnostic>;
+
+  // Returns nullptr if no diagnostic is stored with this key
+  diag_ptr_type get (const std::string& key) const;
+  void add (const std::string& key, const diag_ptr_type& diag);
+
+  // Returns true if the diag was already computed for the current time stamp of its
+  // inputs (with the same allow_invalid_fields flag). Otherwise, returns false, and
+  // marks the diag as computed.
+  bool check_and_set_computed (const std::string& key, const bool allow_invalid_fields);
+
+protected:
+  struct Entry {
+    diag_ptr_type   diag;
+    util::TimeStamp computed_ts;
+    bool            computed_allow_invalid = false;
+  };
+  std::map<std::string,Entry> m_entries;
+};
+
 class AtmosphereOutput
 {
 public:
@@ -124,9 +163,11 @@ public:
   virtual ~AtmosphereOutput () = default;
 
   // Constructor
+  // If diags_registry is not null, diagnostics are shared with other streams using it
   AtmosphereOutput(const ekat::Comm& comm, const ekat::ParameterList& params,
                    const std::shared_ptr<const fm_type>& field_mgr,
-                   const std::shared_ptr<const gm_type>& grids_mgr);
+                   const std::shared_ptr<const gm_type>& grids_mgr,
+                   const std::shared_ptr<OutputDiagnosticsRegistry>& diags_registry = nullptr);
 
   // Short version for outputing a list of fields (no remapping supported)
   AtmosphereOutput(const ekat::Comm& comm,
@@ -204,6 +245,8 @@ protected:
   std::map<std::string,std::shared_ptr<atm_diag_type>>  m_diagnostics;
   std::map<std::string,std::vector<std::string>>        m_diag_depends_on_diags;
   std::map<std::string,bool>                            m_diag_computed;
+  std::shared_ptr<OutputDiagnosticsRegistry>            m_diags_registry;
+  std::map<std::string,std::string>                     m_diag_registry_keys;
 
   // Use float, so that if output fp_precision=float, this is a representable value.
   // Otherwise, you would get an error from Netcdf, like
@@ -219,6 +262,15 @@ protected:
   bool m_add_time_dim;
   bool m_track_avg_cnt = false;
 
+  // If true, the horizontal remap is done only on write steps, on the running sums
+  // accumulated on the source grid (see notes at the top of this file)
+  bool m_defer_horiz_remap = false;
+  std::map<std::string,Field>           m_horiz_remap_accum_fields;
+
+  // If true, writes are done by a background I/O thread, using the host views as staging buffers
+  bool m_async_write = false;
+  std::string m_last_async_filename; // The file the staging buffers were last handed to
+
   // The logger to be used throughout the ATM to log message
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
 };
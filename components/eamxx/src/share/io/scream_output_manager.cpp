@@ -58,6 +58,10 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
   // Read input parameters and setup internal data
   set_params(params,field_mgrs);
 
+  if (not m_diags_registry) {
+    m_diags_registry = std::make_shared<OutputDiagnosticsRegistry>();
+  }
+
   // Here, store if PG2 fields will be present in output streams.
   // Will be useful if multiple grids are defined (see below).
   bool pg2_grid_in_io_streams = false;
@@ -68,7 +72,7 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
 
   // For each grid, create a separate output stream.
   if (field_mgrs.size()==1) {
-    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr);
+    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr,m_diags_registry);
     output->set_logger(m_atm_logger);
     m_output_streams.push_back(output);
   } else {
@@ -101,7 +105,7 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
       EKAT_REQUIRE_MSG (field_mgrs.find(gname)!=field_mgrs.end(),
           "Error! Output requested on grid '" + gname + "', but no field manager is available for such grid.\n");
 
-      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr);
+      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr,m_diags_registry);
       output->set_logger(m_atm_logger);
       m_output_streams.push_back(output);
     }
@@ -435,46 +439,71 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       control.compute_next_write_ts();
       control.nsamples_since_last_write = 0;
 
-      if (m_is_model_restart_output) {
-        // Only write nsteps on model restart
-        set_attribute(filespecs.filename,"nsteps",timestamp.get_num_steps());
-      } else {
-        if (filespecs.ftype==FileType::HistoryRestart) {
-          // Update the date of last write and sample size
-          scorpio::write_timestamp (filespecs.filename,"last_write",m_output_control.last_write_ts,true);
-          scorpio::set_attribute (filespecs.filename,"last_output_filename",m_output_file_specs.filename);
-          scorpio::set_attribute (filespecs.filename,"num_snapshots_since_last_write",m_output_control.nsamples_since_last_write);
-        }
-        // Write these in both output and rhist file. The former, b/c we need these info when we postprocess
-        // output, and the latter b/c we want to make sure these params don't change across restarts
-        set_attribute(filespecs.filename,"averaging_type",e2str(m_avg_type));
-        set_attribute(filespecs.filename,"averaging_frequency_units",m_output_control.frequency_units);
-        set_attribute(filespecs.filename,"averaging_frequency",m_output_control.frequency);
-        set_attribute(filespecs.filename,"file_max_storage_type",e2str(m_output_file_specs.storage.type));
-        if (m_output_file_specs.storage.type==NumSnaps) {
-          set_attribute(filespecs.filename,"max_snapshots_per_file",m_output_file_specs.storage.max_snapshots_in_file);
+      // We're adding one snapshot to the file
+      filespecs.storage.update_storage(timestamp);
+
+      // Gather all we need to write, so that the actual writes can be deferred
+      // to the I/O thread if this stream writes asynchronously
+      const auto filename = filespecs.filename;
+      const auto ftype = filespecs.ftype;
+      const bool needs_flush = filespecs.file_needs_flush();
+      const bool is_model_restart = m_is_model_restart_output;
+      const auto nsteps = timestamp.get_num_steps();
+      const auto last_write_ts = m_output_control.last_write_ts;
+      const auto last_output_filename = m_output_file_specs.filename;
+      const auto nsamples = m_output_control.nsamples_since_last_write;
+      const auto avg_type = e2str(m_avg_type);
+      const auto freq_units = m_output_control.frequency_units;
+      const auto freq = m_output_control.frequency;
+      const auto storage = m_output_file_specs.storage;
+      const auto fp_precision = m_params.get<std::string>("Floating Point Precision");
+      const auto globals = m_globals;
+      const auto time_bnds = m_time_bnds;
+      auto write_to_file = [=]() {
+        if (is_model_restart) {
+          // Only write nsteps on model restart
+          set_attribute(filename,"nsteps",nsteps);
+        } else {
+          if (ftype==FileType::HistoryRestart) {
+            // Update the date of last write and sample size
+            scorpio::write_timestamp (filename,"last_write",last_write_ts,true);
+            scorpio::set_attribute (filename,"last_output_filename",last_output_filename);
+            scorpio::set_attribute (filename,"num_snapshots_since_last_write",nsamples);
+          }
+          // Write these in both output and rhist file. The former, b/c we need these info when we postprocess
+          // output, and the latter b/c we want to make sure these params don't change across restarts
+          set_attribute(filename,"averaging_type",avg_type);
+          set_attribute(filename,"averaging_frequency_units",freq_units);
+          set_attribute(filename,"averaging_frequency",freq);
+          set_attribute(filename,"file_max_storage_type",e2str(storage.type));
+          if (storage.type==NumSnaps) {
+            set_attribute(filename,"max_snapshots_per_file",storage.max_snapshots_in_file);
+          }
+          set_attribute(filename,"fp_precision",fp_precision);
         }
-        const auto& fp_precision = m_params.get<std::string>("Floating Point Precision");
-        set_attribute(filespecs.filename,"fp_precision",fp_precision);
-      }
 
-      // Write all stored globals
-      for (const auto& it : m_globals) {
-        const auto& name = it.first;
-        const auto& any = it.second;
-        set_any_attribute(filespecs.filename,name,any);
-      }
+        // Write all stored globals
+        for (const auto& it : globals) {
+          const auto& name = it.first;
+          const auto& any = it.second;
+          set_any_attribute(filename,name,any);
+        }
 
-      // We're adding one snapshot to the file
-      filespecs.storage.update_storage(timestamp);
+        if (time_bnds.size()>0) {
+          scorpio::grid_write_data_array(filename, "time_bnds", time_bnds.data(), 2);
+        }
 
-      if (m_time_bnds.size()>0) {
-        scorpio::grid_write_data_array(filespecs.filename, "time_bnds", m_time_bnds.data(), 2);
-      }
+        // Check if we need to flush the output file
+        if (needs_flush) {
+          eam_flush_file (filename);
+        }
+      };
 
-      // Check if we need to flush the output file
-      if (filespecs.file_needs_flush()) {
-        eam_flush_file (filespecs.filename);
+      if (m_params.get("async_write",false)) {
+        // Queue after the fields writes, so that PIO sees the same sequence of calls
+        enqueue_io_task(filename,write_to_file);
+      } else {
+        write_to_file();
       }
     };
 
@@ -590,6 +619,9 @@ set_params (const ekat::ParameterList& params,
     // Hard code some parameters in case we access them later
     m_params.set("MPI Ranks in Filename",false);
     m_params.set<std::string>("Floating Point Precision","real");
+
+    // The restart files must be complete by the time the rpointer file is used
+    m_params.set("async_write",false);
   } else {
     auto avg_type = m_params.get<std::string>("Averaging Type");
     m_avg_type = str2avg(avg_type);
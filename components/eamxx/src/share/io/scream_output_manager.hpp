@@ -111,6 +111,12 @@ public:
   void set_logger(const std::shared_ptr<ekat::logger::LoggerBase>& atm_logger) {
       m_atm_logger = atm_logger;
   }
+  // Share output diagnostics with other managers using the same registry.
+  // Must be called before setup. If not called, diags are shared only among
+  // the streams of this manager.
+  void set_diagnostics_registry (const std::shared_ptr<OutputDiagnosticsRegistry>& diags_registry) {
+      m_diags_registry = diags_registry;
+  }
   void add_global (const std::string& name, const ekat::any& global);
   void run (const util::TimeStamp& current_ts);
   void finalize();
@@ -182,6 +188,9 @@ protected:
   // The logger to be used throughout the ATM to log message
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
 
+  // Registry of the diagnostics used by the output streams
+  std::shared_ptr<OutputDiagnosticsRegistry> m_diags_registry;
+
   // If true, we save grid data in output file
   bool m_save_grid_data;
 };
@@ -7,7 +7,14 @@
 
 #include <pio.h>
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 
 
 using scream::Real;
@@ -76,6 +83,172 @@ std::string nctype2str (const int type) {
   return "UNKNOWN";
 }
 /* ----------------------------------------------------------------- */
+// A FIFO queue of I/O tasks, executed by a single background thread.
+// Each task is tagged with the file it operates on, so that callers can wait
+// for the tasks on one file only (e.g., before using its staging buffers).
+// PIO calls are collective, so all ranks must issue them in the same order.
+// Hence, a scorpio call issued from another thread first waits for ALL the
+// pending tasks, regardless of the file (see lock_pio). This also ensures
+// that only one thread at a time is inside PIO, which is not thread safe.
+class IOTaskQueue {
+public:
+  using pio_lock_t = std::unique_lock<std::recursive_mutex>;
+
+  static IOTaskQueue& instance () {
+    static IOTaskQueue q;
+    return q;
+  }
+
+  void enqueue (const std::string& filename, const std::function<void()>& task) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (not m_worker.joinable()) {
+      m_stop = false;
+      m_worker = std::thread([this](){ work(); });
+    }
+    m_tasks.emplace_back(filename,task);
+    ++m_pending[filename];
+    m_cv_work.notify_one();
+  }
+
+  // Wait for all pending tasks on the given file, and rethrow their errors (if any)
+  void wait (const std::string& filename) {
+    if (on_io_thread()) {
+      // Tasks are allowed to call scorpio routines
+      return;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv_done.wait(lock,[&]{ return m_pending.count(filename)==0; });
+    auto it = m_errors.find(filename);
+    if (it!=m_errors.end()) {
+      auto err = it->second;
+      m_errors.erase(it);
+      std::rethrow_exception(err);
+    }
+  }
+
+  // Wait for all pending tasks, and rethrow the first error (if any)
+  void wait () {
+    if (on_io_thread()) {
+      return;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv_done.wait(lock,[this]{ return m_pending.empty(); });
+    if (not m_errors.empty()) {
+      auto err = m_errors.begin()->second;
+      m_errors.clear();
+      std::rethrow_exception(err);
+    }
+  }
+
+  // Wait for all pending tasks, then lock PIO for the calling thread.
+  // Waiting only for the tasks on the same file is not enough: the I/O thread
+  // could then be inside a collective call on another file, and ranks could
+  // end up issuing PIO calls in a different order.
+  pio_lock_t lock_pio () {
+    wait();
+    return pio_lock_t(m_pio_mutex);
+  }
+
+  void stop () {
+    // Stop the worker even if some task failed, then report the error
+    std::exception_ptr err;
+    try {
+      wait();
+    } catch (...) {
+      err = std::current_exception();
+    }
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_stop = true;
+      m_cv_work.notify_one();
+    }
+    if (m_worker.joinable()) {
+      m_worker.join();
+    }
+    if (err) {
+      std::rethrow_exception(err);
+    }
+  }
+
+  ~IOTaskQueue () {
+    // Never throw from a destructor: errors should have been reported by
+    // eam_pio_finalize, so anything left here can only be logged.
+    try {
+      stop();
+    } catch (std::exception& e) {
+      std::cerr << "[EAMxx::scorpio] Error! A pending I/O task failed:\n"
+                << e.what() << "\n";
+    } catch (...) {
+      std::cerr << "[EAMxx::scorpio] Error! A pending I/O task failed with an unknown error.\n";
+    }
+  }
+
+private:
+  static bool& on_io_thread () {
+    static thread_local bool on_io = false;
+    return on_io;
+  }
+
+  void work () {
+    on_io_thread() = true;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_cv_work.wait(lock,[this]{ return m_stop or not m_tasks.empty(); });
+      if (m_tasks.empty()) {
+        // We were asked to stop, and there's nothing left to do
+        break;
+      }
+      auto task = m_tasks.front();
+      m_tasks.pop_front();
+      lock.unlock();
+      std::exception_ptr err;
+      try {
+        pio_lock_t pio_lock(m_pio_mutex);
+        task.second();
+      } catch (...) {
+        err = std::current_exception();
+      }
+      lock.lock();
+      const auto& filename = task.first;
+      if (err and m_errors.count(filename)==0) {
+        m_errors[filename] = err;
+      }
+      if (--m_pending[filename]==0) {
+        m_pending.erase(filename);
+      }
+      m_cv_done.notify_all();
+    }
+  }
+
+  std::deque<std::pair<std::string,std::function<void()>>>  m_tasks;
+  std::map<std::string,int>                 m_pending;  // Queued or running tasks per file
+  std::map<std::string,std::exception_ptr>  m_errors;   // First error per file
+  std::thread                               m_worker;
+  std::mutex                                m_mutex;
+  std::recursive_mutex                      m_pio_mutex;
+  std::condition_variable                   m_cv_work;
+  std::condition_variable                   m_cv_done;
+  bool                                      m_stop = false;
+};
+
+bool async_io_supported () {
+  int thread_level;
+  MPI_Query_thread(&thread_level);
+  return thread_level==MPI_THREAD_MULTIPLE;
+}
+
+void enqueue_io_task (const std::string& filename, const std::function<void()>& task) {
+  IOTaskQueue::instance().enqueue(filename,task);
+}
+
+void wait_for_pending_io_tasks (const std::string& filename) {
+  IOTaskQueue::instance().wait(filename);
+}
+
+void wait_for_pending_io_tasks () {
+  IOTaskQueue::instance().wait();
+}
+/* ----------------------------------------------------------------- */
 void eam_init_pio_subsystem(const ekat::Comm& comm) {
   MPI_Fint fcomm = MPI_Comm_c2f(comm.mpi_comm());
   eam_init_pio_subsystem(fcomm);
@@ -91,28 +264,33 @@ void eam_init_pio_subsystem(const int mpicom, const int atm_id) {
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_finalize() {
+  // Make sure all pending writes are done before shutting down PIO
+  IOTaskQueue::instance().stop();
   eam_pio_finalize_c2f();
 }
 /* ----------------------------------------------------------------- */
 void register_file(const std::string& filename, const FileMode mode) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   register_file_c2f(filename.c_str(),mode);
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_closefile(const std::string& filename) {
-
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   eam_pio_closefile_c2f(filename.c_str());
 }
 void eam_flush_file(const std::string& filename) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   eam_pio_flush_file_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 void set_decomp(const std::string& filename) {
-
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   set_decomp_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 int get_dimlen(const std::string& filename, const std::string& dimname)
 {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   int ncid, dimid, err;
   PIO_Offset len;
 
@@ -150,6 +328,7 @@ int get_dimlen(const std::string& filename, const std::string& dimname)
 /* ----------------------------------------------------------------- */
 bool has_dim (const std::string& filename, const std::string& dimname)
 {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   int ncid, dimid, err;
 
   bool was_open = is_file_open_c2f(filename.c_str(),-1);
@@ -177,6 +356,7 @@ bool has_dim (const std::string& filename, const std::string& dimname)
 /* ----------------------------------------------------------------- */
 bool has_variable (const std::string& filename, const std::string& varname)
 {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   int ncid, varid, err;
 
   bool was_open = is_file_open_c2f(filename.c_str(),-1);
@@ -203,11 +383,13 @@ bool has_variable (const std::string& filename, const std::string& varname)
 
 bool has_attribute (const std::string& filename, const std::string& attname)
 {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   return has_attribute(filename,"GLOBAL",attname);
 }
 
 bool has_attribute (const std::string& filename, const std::string& varname, const std::string& attname)
 {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   int ncid, varid, attid, err;
 
   bool was_open = is_file_open_c2f(filename.c_str(),-1);
@@ -250,17 +432,18 @@ bool has_attribute (const std::string& filename, const std::string& varname, con
 }
 /* ----------------------------------------------------------------- */
 void set_dof(const std::string& filename, const std::string& varname, const Int dof_len, const std::int64_t* x_dof) {
-
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   set_dof_c2f(filename.c_str(),varname.c_str(),dof_len,x_dof);
 }
 /* ----------------------------------------------------------------- */
 void pio_update_time(const std::string& filename, const double time) {
-
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   pio_update_time_c2f(filename.c_str(),time);
 }
 /* ----------------------------------------------------------------- */
 void register_dimension(const std::string &filename, const std::string& shortname, const std::string& longname, const int length, const bool partitioned)
 {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   int mode = get_file_mode_c2f(filename.c_str());
   std::string mode_str = mode==Read ? "Read" : (mode==Write ? "Write" : "Append");
   if (mode!=Write) {
@@ -311,6 +494,7 @@ void register_variable(const std::string& filename, const std::string& shortname
                        const std::vector<std::string>& var_dimensions,
                        const std::string& dtype, const std::string& pio_decomp_tag)
 {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   // This overload does not require to specify an nc data type, so it *MUST* be used when the
   // file access mode is either Read or Append. Either way, a) the var should be on file already,
   // and b) so should be the dimensions
@@ -330,6 +514,7 @@ void register_variable(const std::string &filename, const std::string& shortname
                        const std::string& units_in, const std::vector<std::string>& var_dimensions,
                        const std::string& dtype, const std::string& nc_dtype_in, const std::string& pio_decomp_tag)
 {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   // Local copies, since we can modify them in case of defaults
   auto units = units_in;
   auto nc_dtype = nc_dtype_in;
@@ -478,26 +663,32 @@ void register_variable(const std::string &filename, const std::string& shortname
 }
 /* ----------------------------------------------------------------- */
 void set_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, const float meta_val) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   set_variable_metadata_float_c2f(filename.c_str(),varname.c_str(),meta_name.c_str(),meta_val);
 }
 /* ----------------------------------------------------------------- */
 void set_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, const double meta_val) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   set_variable_metadata_double_c2f(filename.c_str(),varname.c_str(),meta_name.c_str(),meta_val);
 }
 /* ----------------------------------------------------------------- */
 void set_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, const std::string& meta_val) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   set_variable_metadata_char_c2f(filename.c_str(),varname.c_str(),meta_name.c_str(),meta_val.c_str());
 }
 /* ----------------------------------------------------------------- */
 void get_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, float& meta_val) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   meta_val = get_variable_metadata_float_c2f(filename.c_str(),varname.c_str(),meta_name.c_str());
 }
 /* ----------------------------------------------------------------- */
 void get_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, double& meta_val) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   meta_val = get_variable_metadata_double_c2f(filename.c_str(),varname.c_str(),meta_name.c_str());
 }
 /* ----------------------------------------------------------------- */
 void get_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, std::string& meta_val) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   meta_val.resize(256);
   get_variable_metadata_char_c2f(filename.c_str(),varname.c_str(),meta_name.c_str(),&meta_val[0]);
 
@@ -508,11 +699,13 @@ void get_variable_metadata (const std::string& filename, const std::string& varn
 }
 /* ----------------------------------------------------------------- */
 ekat::any get_any_attribute (const std::string& filename, const std::string& att_name) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   auto out = get_any_attribute(filename,"GLOBAL",att_name);
   return out;
 }
 /* ----------------------------------------------------------------- */
 ekat::any get_any_attribute (const std::string& filename, const std::string& var_name, const std::string& att_name) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   register_file(filename,Read);
   auto ncid = get_file_ncid_c2f (filename.c_str());
   EKAT_REQUIRE_MSG (ncid>=0,
@@ -586,6 +779,7 @@ ekat::any get_any_attribute (const std::string& filename, const std::string& var
   return att;
 }
 void set_any_attribute (const std::string& filename, const std::string& att_name, const ekat::any& att) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   auto ncid = get_file_ncid_c2f (filename.c_str());
   int err;
 
@@ -641,39 +835,47 @@ void set_any_attribute (const std::string& filename, const std::string& att_name
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_enddef(const std::string &filename) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   eam_pio_enddef_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_redef(const std::string &filename) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   eam_pio_redef_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 template<>
 void grid_read_data_array<int>(const std::string &filename, const std::string &varname,
                           const int time_index, int *hbuf, const int buf_size) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   grid_read_data_array_c2f_int(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 template<>
 void grid_read_data_array<float>(const std::string &filename, const std::string &varname,
                                 const int time_index, float *hbuf, const int buf_size) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   grid_read_data_array_c2f_float(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 template<>
 void grid_read_data_array<double>(const std::string &filename, const std::string &varname,
                                   const int time_index, double *hbuf, const int buf_size) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   grid_read_data_array_c2f_double(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 /* ----------------------------------------------------------------- */
 template<>
 void grid_write_data_array<int>(const std::string &filename, const std::string &varname, const int* hbuf, const int buf_size) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   grid_write_data_array_c2f_int(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 template<>
 void grid_write_data_array<float>(const std::string &filename, const std::string &varname, const float* hbuf, const int buf_size) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   grid_write_data_array_c2f_float(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 template<>
 void grid_write_data_array<double>(const std::string &filename, const std::string &varname, const double* hbuf, const int buf_size) {
+  auto pio_lock = IOTaskQueue::instance().lock_pio();
   grid_write_data_array_c2f_double(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 /* ----------------------------------------------------------------- */
@@ -8,6 +8,7 @@
 #include "ekat/mpi/ekat_comm.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 
+#include <functional>
 #include <vector>
 
 /* C++/F90 bridge to F90 SCORPIO routines */
@@ -27,6 +28,17 @@ namespace scorpio {
   /* All scorpio usage requires that the pio_subsystem is initialized. Happens only once per simulation */
   void eam_init_pio_subsystem(const ekat::Comm& comm);
   void eam_init_pio_subsystem(const int mpicom, const int atm_id = 0);
+  /* Asynchronous I/O: tasks are executed in FIFO order by a single background thread.
+   * Each task operates on one file. Since PIO calls are collective, every other scorpio
+   * call first waits for ALL pending tasks (and rethrows their errors, if any), so that
+   * all ranks issue PIO calls in the same order. Code calling PIO (or the *_c2f routines
+   * below) directly must call wait_for_pending_io_tasks() first. The per-file version only
+   * waits for the tasks on that file (e.g., before reading a prefetch staging buffer).
+   * Requires MPI_THREAD_MULTIPLE. */
+  bool async_io_supported ();
+  void enqueue_io_task (const std::string& filename, const std::function<void()>& task);
+  void wait_for_pending_io_tasks (const std::string& filename);
+  void wait_for_pending_io_tasks ();
   /* Cleanup scorpio with pio_finalize */
   void eam_pio_finalize();
   /* Close a file currently open in scorpio */
@@ -0,0 +1,309 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_output_manager.hpp"
+#include "share/io/scorpio_input.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/ekat_assert.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace scream {
+
+constexpr int num_output_steps = 3;
+constexpr int freq = 2;
+
+void add (const Field& f, const double v) {
+  auto data = f.get_internal_view_data<Real,Host>();
+  auto nscalars = f.get_header().get_alloc_properties().get_num_scalars();
+  for (int i=0; i<nscalars; ++i) {
+    data[i] += v;
+  }
+  f.sync_to_dev();
+}
+
+util::TimeStamp get_t0 () {
+  return util::TimeStamp({2023,2,17},{0,0,0});
+}
+
+std::shared_ptr<const GridsManager>
+get_gm (const ekat::Comm& comm)
+{
+  const int ngcols = std::max(comm.size()-1,1);
+  const int nlevs = 4;
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  return gm;
+}
+
+std::shared_ptr<FieldManager>
+get_fm (const std::shared_ptr<const AbstractGrid>& grid,
+        const util::TimeStamp& t0, const int seed)
+{
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+  using namespace ShortFieldTagsNames;
+
+  // Use integers, so we can check answers without risk of
+  // non bfb diffs due to different order of sums.
+  std::mt19937_64 engine(seed);
+  auto my_pdf = [&](std::mt19937_64& engine) -> Real {
+    std::uniform_int_distribution<int> pdf (0,100);
+    Real v = pdf(engine);
+    return v;
+  };
+
+  const int nlcols = grid->get_num_local_dofs();
+  const int nlevs  = grid->get_num_vertical_levels();
+
+  std::vector<FL> layouts =
+  {
+    FL({COL    }, {nlcols       }),
+    FL({COL,LEV}, {nlcols, nlevs})
+  };
+
+  auto fm = std::make_shared<FieldManager>(grid);
+
+  const auto units = ekat::units::Units::nondimensional();
+  int count=0;
+  for (const auto& fl : layouts) {
+    FID fid("f_"+std::to_string(count),fl,units,grid->name());
+    Field f(fid);
+    f.allocate_view();
+    randomize (f,engine,my_pdf);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    fm->add_field(f);
+    ++count;
+  }
+
+  return fm;
+}
+
+std::string get_filename (const std::string& prefix, const std::string& avg_type,
+                          const ekat::Comm& comm)
+{
+  return prefix + "." + avg_type
+       + ".nsteps_x" + std::to_string(freq)
+       + ".np" + std::to_string(comm.size())
+       + "." + get_t0().to_string()
+       + ".nc";
+}
+
+ekat::ParameterList get_om_pl (const std::string& prefix,
+                               const std::string& avg_type,
+                               const std::vector<std::string>& fnames)
+{
+  ekat::ParameterList om_pl;
+  om_pl.set("MPI Ranks in Filename",true);
+  om_pl.set("filename_prefix",prefix);
+  om_pl.set("Field Names",fnames);
+  om_pl.set("Averaging Type", avg_type);
+  om_pl.set("Floating Point Precision",std::string("real"));
+  om_pl.set("async_write",true);
+  auto& ctrl_pl = om_pl.sublist("output_control");
+  ctrl_pl.set("frequency_units",std::string("nsteps"));
+  ctrl_pl.set("Frequency",freq);
+  ctrl_pl.set("save_grid_data",false);
+  return om_pl;
+}
+
+void write (const std::string& avg_type, const int seed, const ekat::Comm& comm)
+{
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+
+  auto t0 = get_t0();
+  auto fm = get_fm(grid,t0,seed);
+  std::vector<std::string> fnames;
+  for (auto it : *fm) {
+    fnames.push_back(it.second->name());
+  }
+
+  OutputManager om;
+  om.setup(comm,get_om_pl("io_async",avg_type,fnames),fm,gm,t0,t0,false);
+
+  // Time loop. The model keeps modifying the fields while the previous
+  // snapshots are being written by the I/O thread
+  auto t = t0;
+  for (int n=0; n<num_output_steps*freq; ++n) {
+    t += 1;
+    for (const auto& name : fnames) {
+      add(fm->get_field(name),1.0);
+    }
+    om.run (t);
+  }
+
+  // Waits for the pending writes, and closes the file
+  om.finalize();
+}
+
+void read (const std::string& prefix, const std::string& avg_type,
+           const int seed, const ekat::Comm& comm)
+{
+  const bool instant = avg_type=="INSTANT";
+
+  auto t0 = get_t0();
+  const int num_writes = num_output_steps + (instant ? 1 : 0);
+
+  auto gm = get_gm (comm);
+  auto grid = gm->get_grid("Point Grid");
+
+  // Use wrong seed for fm, so fields are not inited with right data
+  auto fm0 = get_fm(grid,t0,seed);
+  auto fm  = get_fm(grid,t0,-seed-1);
+  std::vector<std::string> fnames;
+  for (auto it : *fm) {
+    fnames.push_back(it.second->name());
+  }
+
+  ekat::ParameterList reader_pl;
+  reader_pl.set("Filename",get_filename(prefix,avg_type,comm));
+  reader_pl.set("Field Names",fnames);
+  AtmosphereInput reader(reader_pl,fm);
+
+  // At output step N, we should get
+  //  avg=INSTANT: output = f(0) + N*freq
+  //  avg=AVERAGE: output = f(0) + N*freq + (freq+1)/2
+  const double delta = (freq+1)/2.0;
+  for (int n=0; n<num_writes; ++n) {
+    reader.read_variables(n);
+    for (const auto& fn : fnames) {
+      auto f0 = fm0->get_field(fn).clone();
+      auto f  = fm->get_field(fn);
+      add(f0,instant ? n*freq : n*freq+delta);
+      REQUIRE (views_are_equal(f,f0));
+    }
+  }
+}
+
+// Prefetch the snapshots of the INSTANT file written by write(), while another
+// file is written asynchronously. The I/O thread then has tasks on both files
+// in flight, interleaved with PIO calls from the main thread.
+void prefetch_and_write (const int seed, const ekat::Comm& comm)
+{
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+  auto t0 = get_t0();
+
+  auto fm0    = get_fm(grid,t0,seed);
+  auto fm_in  = get_fm(grid,t0,-seed-1);
+  auto fm_out = get_fm(grid,t0,seed);
+  std::vector<std::string> fnames;
+  for (auto it : *fm0) {
+    fnames.push_back(it.second->name());
+  }
+
+  ekat::ParameterList reader_pl;
+  reader_pl.set("Filename",get_filename("io_async","INSTANT",comm));
+  reader_pl.set("Field Names",fnames);
+  AtmosphereInput reader(reader_pl,fm_in);
+
+  OutputManager om;
+  om.setup(comm,get_om_pl("io_async_concurrent","INSTANT",fnames),fm_out,gm,t0,t0,false);
+
+  auto t = t0;
+  for (int n=1; n<=num_output_steps; ++n) {
+    reader.prefetch_variables(n);
+    for (int k=0; k<freq; ++k) {
+      t += 1;
+      for (const auto& name : fnames) {
+        add(fm_out->get_field(name),1.0);
+      }
+      om.run (t);
+    }
+
+    // Snapshot n of the INSTANT file is f(0) + n*freq
+    reader.read_variables(n);
+    for (const auto& fn : fnames) {
+      auto f0 = fm0->get_field(fn).clone();
+      add(f0,n*freq);
+      REQUIRE (views_are_equal(fm_in->get_field(fn),f0));
+    }
+  }
+  reader.finalize();
+  om.finalize();
+}
+
+TEST_CASE ("io_async") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::eam_init_pio_subsystem(comm);
+
+  auto seed = get_random_test_seed(&comm);
+
+  // Async writes, then read back
+  {
+    if (not scorpio::async_io_supported()) {
+      // Async output requires MPI_THREAD_MULTIPLE
+      auto gm = get_gm(comm);
+      auto fm = get_fm(gm->get_grid("Point Grid"),get_t0(),seed);
+      OutputManager om;
+      REQUIRE_THROWS (om.setup(comm,get_om_pl("io_async","INSTANT",{"f_0"}),fm,gm,get_t0(),get_t0(),false));
+    } else {
+      for (const std::string& avg : {"INSTANT", "AVERAGE"}) {
+        write(avg,seed,comm);
+        read ("io_async",avg,seed,comm);
+      }
+
+      // Prefetch from one file while writing another, then check what was written
+      prefetch_and_write(seed,comm);
+      read ("io_async_concurrent","INSTANT",seed,comm);
+    }
+  }
+
+  // Ordering: PIO calls are collective, so a scorpio call on a file must wait
+  // for the pending tasks on ALL files, or ranks could issue them in different order
+  {
+    std::atomic<bool> done(false);
+    scorpio::enqueue_io_task("io_async_a.nc",[&](){
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      done = true;
+    });
+    const std::string filename = "io_async_order.np" + std::to_string(comm.size()) + ".nc";
+    scorpio::register_file(filename,scorpio::Write);
+    REQUIRE (done);
+    scorpio::eam_pio_enddef(filename);
+    scorpio::eam_pio_closefile(filename);
+  }
+
+  // Error propagation
+  {
+    // A failing task is reported by the next sync on the same file (and only once),
+    // while syncing on another file is not affected by it
+    scorpio::enqueue_io_task("io_async_a.nc",[](){
+      throw std::runtime_error("Failure in I/O task\n");
+    });
+    scorpio::enqueue_io_task("io_async_b.nc",[](){});
+
+    REQUIRE_NOTHROW (scorpio::wait_for_pending_io_tasks("io_async_b.nc"));
+    REQUIRE_THROWS  (scorpio::wait_for_pending_io_tasks("io_async_a.nc"));
+    REQUIRE_NOTHROW (scorpio::wait_for_pending_io_tasks("io_async_a.nc"));
+
+    // Same for a full sync
+    scorpio::enqueue_io_task("io_async_a.nc",[](){
+      throw std::runtime_error("Failure in I/O task\n");
+    });
+    REQUIRE_THROWS  (scorpio::wait_for_pending_io_tasks());
+    REQUIRE_NOTHROW (scorpio::wait_for_pending_io_tasks());
+  }
+
+  scorpio::eam_pio_finalize();
+}
+
+} // anonymous namespace
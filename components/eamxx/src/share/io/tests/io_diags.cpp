@@ -46,6 +46,9 @@ public:
 
   std::string name() const { return "MyDiag"; }
 
+  // Number of calls to compute_diagnostic_impl, across all instances
+  static int num_computes;
+
   void set_grids (const std::shared_ptr<const GridsManager> gm) {
     using namespace ekat::units;
     using namespace ShortFieldTagsNames;
@@ -79,6 +82,7 @@ protected:
     m_diagnostic_output.deep_copy<Host>(f_in);
     multiply(m_diagnostic_output,2.0);
     m_diagnostic_output.sync_to_dev();
+    ++num_computes;
   }
 
   void initialize_impl (const RunType /* run_type */ ) {
@@ -94,6 +98,8 @@ protected:
   std::string m_f_in;
 };
 
+int MyDiag::num_computes = 0;
+
 util::TimeStamp get_t0 () {
   return util::TimeStamp({2023,2,17},{0,0,0});
 }
@@ -248,6 +254,64 @@ void read (const int seed, const ekat::Comm& comm)
   REQUIRE (views_are_equal(d,f0));
 }
 
+// Two output managers sharing a diagnostics registry compute MyDiag once per step
+void shared (const int seed, const ekat::Comm& comm)
+{
+  // Create grid
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+
+  // Time advance parameters
+  auto t0 = get_t0();
+  const int dt = 10;
+
+  // Create some fields
+  auto fm = get_fm(grid,t0,seed);
+  std::vector<std::string> fnames;
+  for (auto it : *fm) {
+    const auto& fn = it.second->name();
+    fnames.push_back(fn);
+  }
+  fnames.push_back("MyDiag");
+
+  // Create output managers, sharing the registry
+  auto registry = std::make_shared<OutputDiagnosticsRegistry>();
+  OutputManager om1, om2;
+  int count = 0;
+  for (auto om : {&om1, &om2}) {
+    ekat::ParameterList om_pl;
+    om_pl.set("MPI Ranks in Filename",true);
+    om_pl.set("filename_prefix",std::string("io_diags_shared_") + std::to_string(count++));
+    om_pl.set("Field Names",fnames);
+    om_pl.set("Averaging Type", std::string("INSTANT"));
+    auto& ctrl_pl = om_pl.sublist("output_control");
+    ctrl_pl.set("frequency_units",std::string("nsteps"));
+    ctrl_pl.set("Frequency",1);
+    ctrl_pl.set("save_grid_data",false);
+
+    om->set_diagnostics_registry(registry);
+    om->setup(comm,om_pl,fm,gm,t0,t0,false);
+  }
+
+  MyDiag::num_computes = 0;
+  om1.run (t0);
+  om2.run (t0);
+  REQUIRE (MyDiag::num_computes==1);
+
+  // Once the input is updated, the diag is recomputed (once)
+  auto t = t0 + dt;
+  for (auto it : *fm) {
+    it.second->get_header().get_tracking().update_time_stamp(t);
+  }
+  om1.run (t);
+  om2.run (t);
+  REQUIRE (MyDiag::num_computes==2);
+
+  // Close files and cleanup
+  om1.finalize();
+  om2.finalize();
+}
+
 TEST_CASE ("io_diags") {
   ekat::Comm comm(MPI_COMM_WORLD);
   scorpio::eam_init_pio_subsystem(comm);
@@ -272,6 +336,10 @@ TEST_CASE ("io_diags") {
   write(seed,comm);
   read(seed,comm);
   print(" PASS\n");
+
+  print ("-> Share diagnostics across managers ", 40);
+  shared(seed,comm);
+  print(" PASS\n");
   scorpio::eam_pio_finalize();
 }
 
@@ -0,0 +1,268 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_output_manager.hpp"
+#include "share/io/scorpio_input.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <fstream>
+#include <memory>
+#include <numeric>
+
+// Checks that Average output with a horizontal remap from file gives the same
+// results whether the remap is done at every step, or deferred to the write
+// steps (see AtmosphereOutput). Checkpoint steps that are not output steps
+// are included too, since the deferred path remaps its partial sums there.
+
+namespace scream {
+
+constexpr int nlevs = 3;
+constexpr int freq = 4;
+constexpr int checkpoint_freq = 3;
+constexpr int num_output_steps = 2;
+constexpr int nsteps = num_output_steps*freq;
+
+// Every 2 subsequent source columns are mapped to one target column
+constexpr Real wgt = 0.4;
+
+const std::vector<std::string> fnames = {"f_1","f_2"};
+
+util::TimeStamp get_t0 () {
+  return util::TimeStamp({2000,1,1},{0,0,0});
+}
+
+std::shared_ptr<const GridsManager>
+get_gm (const ekat::Comm& comm, const int ngcols)
+{
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  return gm;
+}
+
+std::shared_ptr<FieldManager>
+get_fm (const std::shared_ptr<const AbstractGrid>& grid, const int seed)
+{
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+  using namespace ShortFieldTagsNames;
+
+  std::mt19937_64 engine(seed);
+  auto my_pdf = [&](std::mt19937_64& engine) -> Real {
+    std::uniform_int_distribution<int> pdf (0,100);
+    Real v = pdf(engine);
+    return v;
+  };
+
+  const int nlcols = grid->get_num_local_dofs();
+  const auto units = ekat::units::Units::nondimensional();
+
+  auto fm = std::make_shared<FieldManager>(grid);
+  std::vector<FL> layouts = {FL({COL},{nlcols}), FL({COL,LEV},{nlcols,nlevs})};
+  for (int i=0; i<2; ++i) {
+    Field f(FID(fnames[i],layouts[i],units,grid->name()));
+    f.allocate_view();
+    randomize (f,engine,my_pdf);
+    f.get_header().get_tracking().update_time_stamp(get_t0());
+    fm->add_field(f);
+  }
+  return fm;
+}
+
+void write_remap_file (const std::string& filename, const ekat::Comm& comm,
+                       const int ncols_src_l)
+{
+  const int ncols_src = ncols_src_l*comm.size();
+  const int ncols_tgt_l = ncols_src_l/2;
+  std::vector<Real> col, row, S;
+  for (int ii=0; ii<ncols_tgt_l; ii++) {
+    const int src_col = 2*ii + ncols_src_l*comm.rank();
+    row.push_back(1+ii+ncols_tgt_l*comm.rank());
+    row.push_back(1+ii+ncols_tgt_l*comm.rank());
+    col.push_back(1+src_col);
+    col.push_back(1+src_col+1);
+    S.push_back(wgt);
+    S.push_back(1.0-wgt);
+  }
+  std::vector<std::int64_t> dofs_cols (ncols_src_l);
+  std::iota(dofs_cols.begin(),dofs_cols.end(),comm.rank()*ncols_src_l);
+
+  scorpio::register_file(filename, scorpio::FileMode::Write);
+  scorpio::register_dimension(filename,"n_a","n_a",ncols_src,  true);
+  scorpio::register_dimension(filename,"n_b","n_b",ncols_src/2,true);
+  scorpio::register_dimension(filename,"n_s","n_s",ncols_src,  true);
+  scorpio::register_variable(filename,"col","col","none",{"n_s"},"real","int","int-nnz");
+  scorpio::register_variable(filename,"row","row","none",{"n_s"},"real","int","int-nnz");
+  scorpio::register_variable(filename,"S","S","none",{"n_s"},"real","real","Real-nnz");
+  scorpio::set_dof(filename,"col",dofs_cols.size(),dofs_cols.data());
+  scorpio::set_dof(filename,"row",dofs_cols.size(),dofs_cols.data());
+  scorpio::set_dof(filename,"S",  dofs_cols.size(),dofs_cols.data());
+  scorpio::eam_pio_enddef(filename);
+  scorpio::grid_write_data_array(filename,"row",row.data(),ncols_src);
+  scorpio::grid_write_data_array(filename,"col",col.data(),ncols_src);
+  scorpio::grid_write_data_array(filename,"S",    S.data(),ncols_src);
+  scorpio::eam_pio_closefile(filename);
+}
+
+std::string get_prefix (const bool defer) {
+  return defer ? "io_remap_avg_deferred" : "io_remap_avg_per_step";
+}
+
+void write (const bool defer, const std::string& remap_filename,
+            const int ngcols_src, const int seed, const ekat::Comm& comm)
+{
+  auto gm = get_gm(comm,ngcols_src);
+  auto fm = get_fm(gm->get_grid("Point Grid"),seed);
+
+  ekat::ParameterList om_pl;
+  om_pl.set("MPI Ranks in Filename",true);
+  om_pl.set("filename_prefix",get_prefix(defer));
+  om_pl.set("Field Names",fnames);
+  om_pl.set("Averaging Type",std::string("AVERAGE"));
+  om_pl.set("Floating Point Precision",std::string("real"));
+  om_pl.set("horiz_remap_file",remap_filename);
+  om_pl.set("defer_horiz_remap",defer);
+  auto& ctrl_pl = om_pl.sublist("output_control");
+  ctrl_pl.set("frequency_units",std::string("nsteps"));
+  ctrl_pl.set("Frequency",freq);
+  ctrl_pl.set("save_grid_data",false);
+  auto& chk_pl = om_pl.sublist("Checkpoint Control");
+  chk_pl.set("frequency_units",std::string("nsteps"));
+  chk_pl.set("Frequency",checkpoint_freq);
+  // This skips a test that only matters for AD runs
+  chk_pl.set("is_unit_testing",true);
+
+  OutputManager om;
+  om.setup(comm,om_pl,fm,gm,get_t0(),get_t0(),false);
+
+  // At step n, the fields are f(0)+n
+  auto t = get_t0();
+  for (int n=1; n<=nsteps; ++n) {
+    t += 1;
+    for (const auto& name : fnames) {
+      auto f = fm->get_field(name);
+      auto data = f.get_internal_view_data<Real,Host>();
+      auto nscalars = f.get_header().get_alloc_properties().get_num_scalars();
+      for (int i=0; i<nscalars; ++i) {
+        data[i] += 1;
+      }
+      f.sync_to_dev();
+      f.get_header().get_tracking().update_time_stamp(t);
+    }
+    om.run(t);
+  }
+  om.finalize();
+}
+
+// Read snapshot n of the given file in the fields of fm
+void read (const std::string& filename, const int n,
+           const std::shared_ptr<FieldManager>& fm)
+{
+  ekat::ParameterList reader_pl;
+  reader_pl.set("Filename",filename);
+  reader_pl.set("Field Names",fnames);
+  AtmosphereInput reader(reader_pl,fm);
+  reader.read_variables(n);
+  reader.finalize();
+}
+
+TEST_CASE ("io_remap_avg") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::eam_init_pio_subsystem(comm);
+
+  auto seed = get_random_test_seed(&comm);
+
+  const int ncols_src_l = 8;
+  const int ngcols_src = ncols_src_l*comm.size();
+  const int ngcols_tgt = ngcols_src/2;
+  const auto np = ".np" + std::to_string(comm.size());
+
+  const std::string remap_filename = "io_remap_avg_weights" + np + ".nc";
+  write_remap_file(remap_filename,comm,ncols_src_l);
+
+  {
+    // In normal runs, the OM for the model restart takes care of nuking rpointer.atm,
+    // and re-creating a new one. Here, we don't have that, so we must nuke it manually
+    std::ofstream ofs;
+    ofs.open("rpointer.atm", std::ofstream::out | std::ofstream::trunc);
+  }
+  for (const bool defer : {false, true}) {
+    write(defer,remap_filename,ngcols_src,seed,comm);
+  }
+
+  // The source fields at t0, and the target fields from the two runs
+  auto gm_src = get_gm(comm,ngcols_src);
+  auto gm_tgt = get_gm(comm,ngcols_tgt);
+  auto fm0 = get_fm(gm_src->get_grid("Point Grid"),seed);
+  auto fm_per_step = get_fm(gm_tgt->get_grid("Point Grid"),-seed-1);
+  auto fm_deferred = get_fm(gm_tgt->get_grid("Point Grid"),-seed-2);
+
+  const Real tol = 1000*std::numeric_limits<Real>::epsilon();
+  auto check = [&](const Real nsum, const Real offset) {
+    // Since the weights of each target column add up to 1, the expected value is
+    // nsum*remap(f(0)) + offset
+    for (const auto& name : fnames) {
+      auto f0 = fm0->get_field(name);
+      auto f_per_step = fm_per_step->get_field(name);
+      auto f_deferred = fm_deferred->get_field(name);
+      f_per_step.sync_to_host();
+      f_deferred.sync_to_host();
+      const int rank = f0.rank();
+      const auto v0 = f0.get_internal_view_data<const Real,Host>();
+      const auto v_per_step = f_per_step.get_internal_view_data<const Real,Host>();
+      const auto v_deferred = f_deferred.get_internal_view_data<const Real,Host>();
+      const int nlevs_f = rank==1 ? 1 : nlevs;
+      for (int ii=0; ii<ncols_src_l/2; ++ii) {
+        for (int k=0; k<nlevs_f; ++k) {
+          const int i1 = (2*ii)*nlevs_f + k;
+          const int i2 = (2*ii+1)*nlevs_f + k;
+          const int it = ii*nlevs_f + k;
+          const Real expected = nsum*(wgt*v0[i1] + (1-wgt)*v0[i2]) + offset;
+          REQUIRE (std::abs(v_per_step[it]-expected) <= tol*std::abs(expected));
+          REQUIRE (std::abs(v_deferred[it]-v_per_step[it]) <= tol*std::abs(expected));
+        }
+      }
+    }
+  };
+
+  // At output step N, the average over steps N*freq+1,...,(N+1)*freq is
+  // remap(f(0)) + N*freq + (freq+1)/2
+  const auto t0 = get_t0();
+  for (int n=0; n<num_output_steps; ++n) {
+    const auto suffix = ".AVERAGE.nsteps_x" + std::to_string(freq) + np + "." + t0.to_string() + ".nc";
+    read(get_prefix(false)+suffix,n,fm_per_step);
+    read(get_prefix(true )+suffix,n,fm_deferred);
+    check(1,n*freq + (freq+1)/2.0);
+  }
+
+  // The history restart files hold the partial sums since the last output step.
+  // None of the checkpoint steps are output steps.
+  for (int n=checkpoint_freq; n<nsteps; n+=checkpoint_freq) {
+    REQUIRE (n%freq!=0);
+    auto t = t0;
+    t += n;
+    const auto suffix = ".rhist.AVERAGE.nsteps_x" + std::to_string(checkpoint_freq) + np + "." + t.to_string() + ".nc";
+    read(get_prefix(false)+suffix,0,fm_per_step);
+    read(get_prefix(true )+suffix,0,fm_deferred);
+
+    // Steps (n/freq)*freq+1,...,n were added up
+    const int n0 = (n/freq)*freq;
+    check(n-n0,(n0+1+n)*(n-n0)/2.0);
+  }
+
+  scorpio::eam_pio_finalize();
+}
+
+} // namespace scream
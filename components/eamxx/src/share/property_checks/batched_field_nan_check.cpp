@@ -0,0 +1,165 @@
+#include "share/property_checks/batched_field_nan_check.hpp"
+#include "share/property_checks/field_nan_check.hpp"
+#include "share/field/field_utils.hpp"
+
+#include "ekat/util/ekat_math_utils.hpp"
+
+namespace scream
+{
+
+BatchedFieldNaNCheck::
+BatchedFieldNaNCheck (const std::list<Field>& fields,
+                      const std::shared_ptr<const AbstractGrid>& grid)
+ : m_has_dynamic_subfields (false)
+ , m_total_size (0)
+ , m_grid (grid)
+{
+  // Sanity checks
+  EKAT_REQUIRE_MSG (fields.size()>0,
+      "Error in BatchedFieldNaNCheck constructor: input fields list is empty.\n");
+  for (const auto& f : fields) {
+    EKAT_REQUIRE_MSG (f.rank()<=6,
+        "Error in BatchedFieldNaNCheck constructor: unsupported field rank.\n"
+        "  - Field name: " + f.name() << "\n"
+        "  - Field rank: " + std::to_string(f.rank()) + "\n");
+    EKAT_REQUIRE_MSG (f.data_type()==get_data_type<Real>(),
+        "Error in BatchedFieldNaNCheck constructor: field data type not supported.\n"
+        "  - Field name: " + f.name() << "\n"
+        "  - Field data type: " + e2str(f.data_type()) + "\n");
+    EKAT_REQUIRE_MSG (grid==nullptr || f.get_header().get_identifier().get_grid_name()==grid->name(),
+        "Error! The name of the input grid does not match the grid name stored in the field identifier.\n"
+        "  - Field name: " + f.name() + "\n"
+        "  - Field grid name: " + f.get_header().get_identifier().get_grid_name() + "\n"
+        "  - Input grid name: " + grid->name() + "\n");
+
+    m_has_dynamic_subfields |= f.get_header().get_alloc_properties().is_dynamic_subfield();
+  }
+
+  // We can't repair NaN's.
+  set_fields (fields,std::list<bool>(fields.size(),false));
+
+  m_info   = decltype(m_info)("nan_check_fields_info",fields.size());
+  m_info_h = Kokkos::create_mirror_view(m_info);
+  update_fields_info ();
+}
+
+std::string BatchedFieldNaNCheck::name () const {
+  std::string n = "NaN check for fields";
+  std::string sep = " ";
+  for (const auto& f : fields()) {
+    n += sep + f.name();
+    sep = ", ";
+  }
+  return n;
+}
+
+void BatchedFieldNaNCheck::update_fields_info () const
+{
+  long long offset = 0;
+  int ifield = 0;
+  for (const auto& f : fields()) {
+    auto& info = m_info_h(ifield++);
+    const auto& layout = f.get_header().get_identifier().get_layout();
+    info.rank   = layout.rank();
+    info.offset = offset;
+    for (int i=0; i<info.rank; ++i) {
+      info.extents[i] = layout.dim(i);
+    }
+
+    // Rank-1 subfields are not necessarily contiguous, so use the strided view
+    // for them. For higher ranks, the view of a subfield is still LayoutRight,
+    // with a padded leading stride.
+    auto set_strides = [&](const auto& v) {
+      info.data = v.data();
+      for (int i=0; i<info.rank; ++i) {
+        info.strides[i] = v.stride(i);
+      }
+    };
+    switch (info.rank) {
+      case 1: set_strides(f.get_strided_view<const Real*>());   break;
+      case 2: set_strides(f.get_view<const Real**>());          break;
+      case 3: set_strides(f.get_view<const Real***>());         break;
+      case 4: set_strides(f.get_view<const Real****>());        break;
+      case 5: set_strides(f.get_view<const Real*****>());       break;
+      case 6: set_strides(f.get_view<const Real******>());      break;
+      default:
+        EKAT_ERROR_MSG (
+            "Internal error in BatchedFieldNaNCheck: unsupported field rank.\n"
+            "You should not have reached this line. Please, contact developers.\n");
+    }
+    offset += layout.size();
+  }
+  m_total_size = offset;
+  Kokkos::deep_copy(m_info,m_info_h);
+}
+
+long long BatchedFieldNaNCheck::find_first_nan () const
+{
+  const auto info = m_info;
+  const int nfields = info.extent(0);
+
+  long long first_nan_idx = m_total_size;
+  using min_t = Kokkos::Min<long long>;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<typename KT::ExeSpace,long long>(0,m_total_size),
+                          KOKKOS_LAMBDA(const long long idx, long long& result) {
+    // Find the field this index belongs to
+    int lo = 0, hi = nfields-1;
+    while (lo<hi) {
+      const int mid = (lo+hi+1)/2;
+      if (info(mid).offset<=idx) {
+        lo = mid;
+      } else {
+        hi = mid-1;
+      }
+    }
+    const auto& fi = info(lo);
+
+    // Unflatten the index, and get the offset in the field data
+    long long i = idx - fi.offset;
+    long long pos = 0;
+    for (int d=fi.rank-1; d>=0; --d) {
+      pos += (i % fi.extents[d])*fi.strides[d];
+      i /= fi.extents[d];
+    }
+    if (ekat::is_invalid(fi.data[pos]) && idx<result) {
+      result = idx;
+    }
+  }, min_t(first_nan_idx));
+
+  return first_nan_idx<m_total_size ? first_nan_idx : -1;
+}
+
+PropertyCheck::ResultAndMsg BatchedFieldNaNCheck::check() const {
+  if (m_has_dynamic_subfields) {
+    update_fields_info ();
+  }
+
+  const auto nan_idx = find_first_nan ();
+  if (nan_idx<0) {
+    PropertyCheck::ResultAndMsg res_and_msg;
+    res_and_msg.result = CheckResult::Pass;
+    res_and_msg.msg = "BatchedFieldNaNCheck passed.\n";
+    return res_and_msg;
+  }
+
+  // Find the first failing field, and run the single-field check on it,
+  // which takes care of building the (detailed) failure message
+  int ifield = 0;
+  for (const auto& f : fields()) {
+    const auto& fi = m_info_h(ifield++);
+    const auto size = f.get_header().get_identifier().get_layout().size();
+    if (nan_idx>=fi.offset && nan_idx<fi.offset+size) {
+      FieldNaNCheck nan_check(f,m_grid);
+      for (const auto& data : additional_data_fields()) {
+        nan_check.set_additional_data_field(data);
+      }
+      return nan_check.check();
+    }
+  }
+
+  EKAT_ERROR_MSG (
+      "Internal error in BatchedFieldNaNCheck: could not find the field containing the NaN.\n"
+      "You should not have reached this line. Please, contact developers.\n");
+}
+
+} // namespace scream
@@ -0,0 +1,66 @@
+#ifndef SCREAM_BATCHED_FIELD_NAN_CHECK_HPP
+#define SCREAM_BATCHED_FIELD_NAN_CHECK_HPP
+
+#include "share/property_checks/property_check.hpp"
+#include "share/grid/abstract_grid.hpp"
+
+#include <ekat/kokkos/ekat_kokkos_types.hpp>
+
+namespace scream
+{
+
+// Inspect whether any of a set of fields contains NaN values.
+// This is equivalent to creating one FieldNaNCheck per field, but all the
+// fields are scanned in a single kernel (with a single reduction), which
+// greatly reduces launch overhead when many fields need to be checked.
+// If a NaN is found, the reported failure is the one of the first field
+// (in the order they were passed) that contains a NaN.
+// All fields must be defined on the same grid, and have Real data type.
+// No repair allowed. If we find NaN's, we should crash.
+class BatchedFieldNaNCheck: public PropertyCheck {
+public:
+  BatchedFieldNaNCheck (const std::list<Field>& fields,
+                        const std::shared_ptr<const AbstractGrid>& grid);
+
+  // The name of the field check
+  std::string name () const override;
+
+  PropertyType type () const override { return PropertyType::PointWise; }
+
+  ResultAndMsg check() const override;
+
+  // Info needed to access the entries of a field from a flattened index
+  struct FieldInfo {
+    const Real* data;
+    long long   offset;     // Offset of this field in the batch flattened index
+    int         rank;
+    int         extents[6];
+    long long   strides[6];
+  };
+
+// CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
+#ifndef EAMXX_ENABLE_GPU
+protected:
+#endif
+  // Returns the (batch-flattened) index of the first NaN, or -1 if none is found
+  long long find_first_nan () const;
+
+private:
+
+  void update_fields_info () const;
+
+  using KT = ekat::KokkosTypes<DefaultDevice>;
+
+  // We need to refresh the info if some fields are dynamic subfields,
+  // since their data pointer changes with the slice index
+  bool                                                m_has_dynamic_subfields;
+  mutable KT::view_1d<FieldInfo>                      m_info;
+  mutable typename KT::view_1d<FieldInfo>::HostMirror m_info_h;
+  mutable long long                                   m_total_size;
+
+  std::shared_ptr<const AbstractGrid> m_grid;
+};
+
+} // namespace scream
+
+#endif // SCREAM_BATCHED_FIELD_NAN_CHECK_HPP
@@ -216,6 +216,20 @@ TEST_CASE ("get_remote_pids_and_lids") {
     REQUIRE (pids[i]==expected_pid);
     REQUIRE (lids[i]==expected_lid);
   }
+
+  // Ask only for (a repeated subset of) the dofs of the next rank
+  const int next = (comm.rank()+1) % comm.size();
+  std::vector<gid_type> next_dofs;
+  for (int i=0; i<num_local_dofs; i+=2) {
+    next_dofs.push_back(all_dofs[next*num_local_dofs+i]);
+    next_dofs.push_back(all_dofs[next*num_local_dofs+i]);
+  }
+  grid->get_remote_pids_and_lids(next_dofs,pids,lids);
+  REQUIRE (pids.size()==next_dofs.size());
+  for (size_t k=0; k<next_dofs.size(); ++k) {
+    REQUIRE (pids[k]==next);
+    REQUIRE (lids[k]==static_cast<int>(2*(k/2)));
+  }
 }
 
 } // anonymous namespace
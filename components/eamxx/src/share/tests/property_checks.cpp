@@ -5,6 +5,7 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_upper_bound_check.hpp"
 #include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/batched_field_nan_check.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/field/field_utils.hpp"
@@ -130,6 +131,53 @@ TEST_CASE("property_checks", "") {
     REQUIRE( res_and_msg.msg == expected_msg );
   }
 
+  // Check that values are not NaN, checking several fields at once
+  SECTION("batched_field_not_nan_check") {
+    const auto num_reals = f.get_header().get_alloc_properties().get_num_scalars();
+
+    FieldIdentifier fid2 ("field_2", {{COL,LEV},{num_lcols,nlevs}}, m/s,"some_grid");
+    Field f2(fid2);
+    f2.allocate_view();
+    f2.deep_copy(1.0);
+
+    // A (non-contiguous) subfield of f
+    auto f1 = f.get_component(1);
+
+    auto nan_check = std::make_shared<BatchedFieldNaNCheck>(std::list<Field>{f2,f1},grid);
+
+    // Assign  values to the fields and make sure it passes our test for NaNs.
+    auto f_data = reinterpret_cast<Real*>(f.get_internal_view_data<Real,Host>());
+    ekat::genRandArray(f_data,num_reals,engine,neg_pdf);
+    f.sync_to_dev();
+    auto res_and_msg = nan_check->check();
+    REQUIRE(res_and_msg.result==CheckResult::Pass);
+
+    // A NaN in a component of f that is not checked does not trigger a fail
+    auto f_view = f.get_view<Real***,Host>();
+    f_view(1,2,3) = std::numeric_limits<Real>::quiet_NaN();
+    f.sync_to_dev();
+    res_and_msg = nan_check->check();
+    REQUIRE(res_and_msg.result==CheckResult::Pass);
+
+    // A NaN in the checked component does, and the failure is reported
+    // as in the single-field check
+    f_view(1,1,3) = std::numeric_limits<Real>::quiet_NaN();
+    f.sync_to_dev();
+    res_and_msg = nan_check->check();
+    REQUIRE(res_and_msg.result==CheckResult::Fail);
+    REQUIRE(res_and_msg.fail_loc_indices==std::vector<int>{1,3});
+    REQUIRE(res_and_msg.msg==FieldNaNCheck(f1,grid).check().msg);
+
+    // If more fields fail, the first one in the batch is reported
+    auto f2_view = f2.get_view<Real**,Host>();
+    f2_view(0,5) = std::numeric_limits<Real>::quiet_NaN();
+    f2.sync_to_dev();
+    res_and_msg = nan_check->check();
+    REQUIRE(res_and_msg.result==CheckResult::Fail);
+    REQUIRE(res_and_msg.fail_loc_indices==std::vector<int>{0,5});
+    REQUIRE(res_and_msg.msg==FieldNaNCheck(f2,grid).check().msg);
+  }
+
   // Check that the values of a field lie within an interval.
   SECTION ("field_within_interval_check") {
     const auto num_reals = f.get_header().get_alloc_properties().get_num_scalars();
@@ -12,8 +12,9 @@ namespace scream {
 class RefiningRemapperRMATester : public RefiningRemapperRMA {
 public:
   RefiningRemapperRMATester (const grid_ptr_type& tgt_grid,
-                          const std::string& map_file)
-   : RefiningRemapperRMA(tgt_grid,map_file) {}
+                          const std::string& map_file,
+                          const bool aggregate_gets = true)
+   : RefiningRemapperRMA(tgt_grid,map_file,aggregate_gets) {}
 
   ~RefiningRemapperRMATester () = default;
 
@@ -26,7 +27,9 @@ public:
     REQUIRE (m_col_size.size()==n);
     REQUIRE (m_col_stride.size()==n);
     REQUIRE (m_col_offset.size()==n);
-    REQUIRE (m_mpi_win.size()==n);
+    // With aggregated gets, all fields share a single (dynamic) window
+    REQUIRE (m_mpi_win.size()==(m_aggregate_gets ? 0 : n));
+    REQUIRE ((m_agg_win!=MPI_WIN_NULL)==m_aggregate_gets);
     REQUIRE (m_remote_lids.size()==static_cast<size_t>(m_ov_coarse_grid->get_num_local_dofs()));
     REQUIRE (m_remote_pids.size()==static_cast<size_t>(m_ov_coarse_grid->get_num_local_dofs()));
 
@@ -474,6 +477,48 @@ TEST_CASE ("refining_remapper") {
     }
   }
 
+  // Per-field windows (one MPI_Get per column) must yield the same result
+  {
+    if (comm.am_i_root()) {
+      printf(" -> Checking per-field windows ..\n");
+    }
+    auto r2 = std::make_shared<RefiningRemapperRMATester>(tgt_grid,filename,false);
+
+    auto bundle_tgt2 = create_field("bundle3d_tgt",LayoutType::Vector3D,*tgt_grid);
+    auto s2d_tgt2    = create_field("s2d_tgt",LayoutType::Scalar2D,*tgt_grid);
+    auto v2d_tgt2    = create_field("v2d_tgt",LayoutType::Vector2D,*tgt_grid);
+    auto s3d_tgt2    = create_field("s3d_tgt",LayoutType::Scalar3D,*tgt_grid);
+    auto v3d_tgt2    = create_field("v3d_tgt",LayoutType::Vector3D,*tgt_grid);
+
+    r2->registration_begins();
+    r2->register_field(s2d_src,s2d_tgt2);
+    r2->register_field(v2d_src,v2d_tgt2);
+    r2->register_field(s3d_src,s3d_tgt2);
+    r2->register_field(v3d_src,v3d_tgt2);
+    r2->register_field(bundle_src.get_component(0),bundle_tgt2.get_component(0));
+    r2->register_field(bundle_src.get_component(1),bundle_tgt2.get_component(1));
+    r2->registration_ends();
+
+    // Run twice, to check that the windows/datatypes can be reused
+    r2->remap(true);
+    r2->remap(true);
+
+    bool ok = true;
+    CHECK (views_are_equal(s2d_tgt,s2d_tgt2));
+    ok &= catch_capture.lastAssertionPassed();
+    CHECK (views_are_equal(v2d_tgt,v2d_tgt2));
+    ok &= catch_capture.lastAssertionPassed();
+    CHECK (views_are_equal(s3d_tgt,s3d_tgt2));
+    ok &= catch_capture.lastAssertionPassed();
+    CHECK (views_are_equal(v3d_tgt,v3d_tgt2));
+    ok &= catch_capture.lastAssertionPassed();
+    CHECK (views_are_equal(bundle_tgt,bundle_tgt2));
+    ok &= catch_capture.lastAssertionPassed();
+    if (comm.am_i_root()) {
+      printf(" -> Checking per-field windows .. %s\n",ok ? "PASS" : "FAIL");
+    }
+  }
+
   // Clean up
   r = nullptr;
   scorpio::eam_pio_finalize();
@@ -4,9 +4,12 @@
 #include "share/util/scream_universal_constants.hpp"
 #include "share/util/scream_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
+#include "share/util/scream_timing.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 #include "share/scream_config.hpp"
 
+#include <fstream>
+
 TEST_CASE("contiguous_superset") {
   using namespace scream;
 
@@ -250,3 +253,50 @@ TEST_CASE ("array_utils") {
     }
   }
 }
+
+TEST_CASE ("timers") {
+  using namespace scream;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  bool gptl_was_inited;
+  init_gptl(gptl_was_inited);
+  enable_timers_trace(4);
+
+  // Registering the same name twice gives the same handle
+  const int t1 = register_timer("utils_tests::t1");
+  const int t2 = register_timer("utils_tests::t2");
+  REQUIRE (t1!=t2);
+  REQUIRE (register_timer("utils_tests::t1")==t1);
+  REQUIRE (get_timer_name(t2)=="utils_tests::t2");
+
+  // The string-based version uses the same registry
+  start_timer(t1);
+  start_timer("utils_tests::t2");
+  stop_timer(t2);
+  stop_timer("utils_tests::t1");
+
+  // The trace buffer is full, so these are discarded
+  start_timer(t1);
+  stop_timer(t1);
+
+  const std::string prefix = "timers_trace_np" + std::to_string(comm.size());
+  write_timers_trace(comm,prefix);
+
+  std::ifstream ifile(prefix + "." + std::to_string(comm.rank()) + ".json");
+  REQUIRE (ifile.good());
+  std::string line, content;
+  int num_begin = 0, num_end = 0;
+  while (std::getline(ifile,line)) {
+    num_begin += line.find("\"ph\":\"B\"")!=std::string::npos;
+    num_end   += line.find("\"ph\":\"E\"")!=std::string::npos;
+    content += line;
+  }
+  REQUIRE (num_begin==2);
+  REQUIRE (num_end==2);
+  REQUIRE (content.find("\"num_dropped_events\":2")!=std::string::npos);
+
+  if (not gptl_was_inited) {
+    finalize_gptl();
+  }
+}
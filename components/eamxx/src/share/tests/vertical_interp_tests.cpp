@@ -193,13 +193,16 @@ void check_mask(const view_Nd_host<Mask<P>,2>& mask, int col, int lev){
 
 TEST_CASE("testing_masking"){
   printf (" -- Testing Masking --\n");
-  //This test performs 3 tests:
+  //This test performs 4 tests:
   //1) That the interpolation is working properly using 2d views, 
   //   including the masking of out-of-bounds values
   //2) It checks the interpolation is working properly with 
   //   a user defined masking value
   //3) It checks that the interpolation is working properly when 
   //   using the 1d interpolation function
+  //4) It checks that a precomputed VertInterpPlan gives the same
+  //   answer, and can be reused for several variables, also when
+  //   they are stored in a single 3d view
   const int n_layers_src = 9;
   const int n_layers_tgt = 17;
   const int P = SCREAM_PACK_SIZE;
@@ -353,5 +356,211 @@ TEST_CASE("testing_masking"){
     }
   }
 
+  //Check that interpolating with a precomputed plan gives the same answer,
+  //also when the plan is used more than once
+  std::vector<Real> tgt_levs(n_layers_tgt);
+  for (int i=0; i<n_layers_tgt; i++){
+    tgt_levs[i] = p_tgt_h_s(i);
+  }
+  VertInterpPlan<Real,P> plan(2,n_layers_src,tgt_levs);
+  plan.setup(p_src);
+  for (int itest=0; itest<2; itest++){
+    auto out_plan = view_Nd<Pack<Real,P>,2>("",2,npacks_tgt);
+    auto out_plan_h = Kokkos::create_mirror_view(out_plan);
+    auto out_plan_h_s = ekat::scalarize(out_plan_h);
+    auto mask_plan = view_Nd<Mask<P>,2>("",2,npacks_tgt);
+    auto mask_plan_h = Kokkos::create_mirror_view(mask_plan);
+    perform_vertical_interpolation<Real,P,2>(p_src,
+                                             plan,
+                                             tmp_src,
+                                             out_plan,
+                                             mask_plan,
+                                             mod_mask_val);
+
+    Kokkos::deep_copy(out_plan_h,out_plan);
+    Kokkos::deep_copy(mask_plan_h,mask_plan);
+
+    for(int col=0; col<2; col++){
+      for(int lev=0; lev<17; lev++){
+        REQUIRE(out_plan_h_s(col,lev) == correct_val[col][lev]);
+        check_mask<P>(mask_plan_h,col,lev);
+      }
+    }
+  }
+
+  //Check the plan with 3d views (several variables per column). All the
+  //variables of a column share the setup of that column
+  const int nvars = 3;
+  auto tmp_src_3d     = view_Nd<Pack<Real,P>,3>("",2,nvars,npacks_src);
+  auto tmp_src_3d_h   = Kokkos::create_mirror_view(tmp_src_3d);
+  auto tmp_src_3d_h_s = ekat::scalarize(tmp_src_3d_h);
+  for (int col=0; col<2; col++){
+    for (int ivar=0; ivar<nvars; ivar++){
+      for (int lev=0; lev<n_layers_src; lev++){
+        tmp_src_3d_h_s(col,ivar,lev) = tmp_src_h_s(col,lev) + 100.*ivar;
+      }
+    }
+  }
+  Kokkos::deep_copy(tmp_src_3d,tmp_src_3d_h);
+
+  auto out_3d      = view_Nd<Pack<Real,P>,3>("",2,nvars,npacks_tgt);
+  auto mask_3d     = view_Nd<Mask<P>,3>("",2,nvars,npacks_tgt);
+  auto out_3d_ref  = view_Nd<Pack<Real,P>,3>("",2,nvars,npacks_tgt);
+  auto mask_3d_ref = view_Nd<Mask<P>,3>("",2,nvars,npacks_tgt);
+  perform_vertical_interpolation<Real,P,3>(p_src,
+                                           plan,
+                                           tmp_src_3d,
+                                           out_3d,
+                                           mask_3d,
+                                           mod_mask_val);
+  perform_vertical_interpolation<Real,P,3>(p_src,
+                                           p_tgt,
+                                           tmp_src_3d,
+                                           out_3d_ref,
+                                           mask_3d_ref,
+                                           n_layers_src,
+                                           n_layers_tgt,
+                                           mod_mask_val);
+
+  auto out_3d_h       = Kokkos::create_mirror_view(out_3d);
+  auto out_3d_h_s     = ekat::scalarize(out_3d_h);
+  auto mask_3d_h      = Kokkos::create_mirror_view(mask_3d);
+  auto out_3d_ref_h   = Kokkos::create_mirror_view(out_3d_ref);
+  auto out_3d_ref_h_s = ekat::scalarize(out_3d_ref_h);
+  auto mask_3d_ref_h  = Kokkos::create_mirror_view(mask_3d_ref);
+  Kokkos::deep_copy(out_3d_h,out_3d);
+  Kokkos::deep_copy(mask_3d_h,mask_3d);
+  Kokkos::deep_copy(out_3d_ref_h,out_3d_ref);
+  Kokkos::deep_copy(mask_3d_ref_h,mask_3d_ref);
+
+  for(int col=0; col<2; col++){
+    for (int ivar=0; ivar<nvars; ivar++){
+      for(int lev=0; lev<17; lev++){
+        const int ipack = lev / P;
+        const int jpack = lev % P;
+        const bool masked = (col == 0 && lev == 16) || (col == 1 && lev == 0);
+        REQUIRE(out_3d_h_s(col,ivar,lev) == out_3d_ref_h_s(col,ivar,lev));
+        REQUIRE(mask_3d_h(col,ivar,ipack)[jpack] == mask_3d_ref_h(col,ivar,ipack)[jpack]);
+        REQUIRE(mask_3d_h(col,ivar,ipack)[jpack] == masked);
+        if (masked){
+          REQUIRE(out_3d_h_s(col,ivar,lev) == mod_mask_val);
+        }
+        else{
+          REQUIRE(out_3d_h_s(col,ivar,lev) == correct_val[col][lev] + 100.*ivar);
+        }
+      }
+    }
+  }
+
+}
+
+TEST_CASE("vertical_interpolation_plan_cache"){
+  printf (" -- Testing caching of vertical interpolation plans --\n");
+  //This test checks that get_vertical_interpolation_plan:
+  //1) returns the same plan for the same target levels, and a different
+  //   one for different target levels
+  //2) does not redo the setup if the time stamp of the source coordinate
+  //   did not change, even if its values did
+  //3) redoes the setup once the time stamp is updated
+  using namespace ShortFieldTagsNames;
+  const int ncols = 2;
+  const int n_layers_src = 9;
+  const int n_layers_tgt = 6;
+  const int P = SCREAM_PACK_SIZE;
+
+  auto npacks_src = ekat::PackInfo<P>::num_packs(n_layers_src);
+  auto npacks_tgt = ekat::PackInfo<P>::num_packs(n_layers_tgt);
+
+  FieldIdentifier fid("p_mid",FieldLayout({COL,LEV},{ncols,n_layers_src}),
+                      ekat::units::Pa,"some_grid");
+  Field p_src(fid);
+  p_src.get_header().get_alloc_properties().request_allocation(P);
+  p_src.allocate_view();
+
+  //Set source levels to 20-100 in both columns, with a quadratic input,
+  //so that using the wrong brackets gives a different answer
+  auto set_p_src = [&](const Real shift) {
+    auto p_src_h = p_src.get_view<Real**,Host>();
+    for (int col=0; col<ncols; col++){
+      for (int lev=0; lev<n_layers_src; lev++){
+        p_src_h(col,lev) = 20.0 + lev*10.0 + (col==0 ? shift : 0);
+      }
+    }
+    p_src.sync_to_dev();
+  };
+  set_p_src(0);
+
+  auto input   = view_Nd<Pack<Real,P>,2>("",ncols,npacks_src);
+  auto input_h = Kokkos::create_mirror_view(input);
+  auto input_h_s = ekat::scalarize(input_h);
+  for (int col=0; col<ncols; col++){
+    for (int lev=0; lev<n_layers_src; lev++){
+      input_h_s(col,lev) = lev*lev;
+    }
+  }
+  Kokkos::deep_copy(input,input_h);
+
+  std::vector<Real> tgt_levs(n_layers_tgt);
+  for (int i=0; i<n_layers_tgt; i++){
+    tgt_levs[i] = 35.0 + i*10.0;
+  }
+
+  //Interpolate the input with the given plan, and return the output on host
+  auto interp = [&](const VertInterpPlan<Real,P>& plan) {
+    auto out  = view_Nd<Pack<Real,P>,2>("",ncols,npacks_tgt);
+    auto mask = view_Nd<Mask<P>,2>("",ncols,npacks_tgt);
+    perform_vertical_interpolation<Real,P,2>(p_src.get_view<const Pack<Real,P>**>(),
+                                             plan,input,out,mask);
+    auto out_h = Kokkos::create_mirror_view(out);
+    Kokkos::deep_copy(out_h,out);
+    return out_h;
+  };
+  using out_host_t = typename view_Nd<Pack<Real,P>,2>::HostMirror;
+  auto same = [&](const out_host_t& a, const out_host_t& b) {
+    auto a_s = ekat::scalarize(a);
+    auto b_s = ekat::scalarize(b);
+    for (int col=0; col<ncols; col++){
+      for (int lev=0; lev<n_layers_tgt; lev++){
+        if (a_s(col,lev)!=b_s(col,lev)){
+          return false;
+        }
+      }
+    }
+    return true;
+  };
+
+  util::TimeStamp t0({2000,1,1},{0,0,0});
+  p_src.get_header().get_tracking().update_time_stamp(t0);
+
+  //1) Same target levels give the same plan, different ones a different plan
+  auto plan = get_vertical_interpolation_plan<P>(p_src,tgt_levs);
+  REQUIRE (get_vertical_interpolation_plan<P>(p_src,tgt_levs)==plan);
+  auto other_levs = tgt_levs;
+  other_levs[0] += 1;
+  REQUIRE (get_vertical_interpolation_plan<P>(p_src,other_levs)!=plan);
+
+  //A plan set up on the original coordinate, to compare against
+  VertInterpPlan<Real,P> old_plan(ncols,n_layers_src,tgt_levs);
+  old_plan.setup(p_src.get_view<const Pack<Real,P>**>());
+  REQUIRE (same(interp(*plan),interp(old_plan)));
+
+  //2) Change the coordinate, but not its time stamp: the cached plan is
+  //   returned as is, with the brackets of the original coordinate
+  set_p_src(12);
+  auto cached = get_vertical_interpolation_plan<P>(p_src,tgt_levs);
+  REQUIRE (cached==plan);
+  REQUIRE (same(interp(*cached),interp(old_plan)));
+
+  //3) After a time stamp update, the same plan is set up again
+  auto t1 = t0;
+  t1 += 1;
+  p_src.get_header().get_tracking().update_time_stamp(t1);
+  auto fresh = get_vertical_interpolation_plan<P>(p_src,tgt_levs);
+  REQUIRE (fresh==plan);
+
+  VertInterpPlan<Real,P> new_plan(ncols,n_layers_src,tgt_levs);
+  new_plan.setup(p_src.get_view<const Pack<Real,P>**>());
+  REQUIRE (same(interp(*fresh),interp(new_plan)));
+  REQUIRE (not same(interp(new_plan),interp(old_plan)));
 }
 
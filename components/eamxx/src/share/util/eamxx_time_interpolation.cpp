@@ -275,6 +275,8 @@ void TimeInterpolation::set_file_data_triplets(const vos_type& list_of_files) {
     }
     scorpio::register_file(filename,scorpio::Read);
     const int ntime = scorpio::get_dimlen(filename,"time");
+    // The time reads below call PIO directly, so make sure no I/O task is in flight
+    scorpio::wait_for_pending_io_tasks();
     for (int tt=0; tt<ntime; tt++) {
       auto time_snap = scorpio::read_time_at_index_c2f(filename.c_str(),tt+1);
       TimeStamp ts_snap = ts_file_start;
@@ -337,6 +339,16 @@ void TimeInterpolation::read_data()
   }
   m_file_data_atm_input.read_variables(triplet_curr.time_idx);
   m_time1 = triplet_curr.timestamp;
+
+  // Start reading the next snap, so it's ready when we need it. We only do this if the
+  // next snap is in the same file, since switching files requires re-initing the input.
+  const int next_idx = m_triplet_idx+1;
+  if (m_prefetch_data and next_idx<static_cast<int>(m_file_data_triplets.size())) {
+    const auto& triplet_next = m_file_data_triplets[next_idx];
+    if (triplet_next.filename==triplet_curr.filename) {
+      m_file_data_atm_input.prefetch_variables(triplet_next.time_idx);
+    }
+  }
 }
 /*-----------------------------------------------------------------------------------------------*/
 /* Function to check the current set of interpolation data against a timestamp and, if needed,
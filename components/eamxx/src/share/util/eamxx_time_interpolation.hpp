@@ -45,6 +45,12 @@ public:
   // Informational
   void print();
 
+  // Option to read the next snap of data from file in the background, so that
+  // updating the data when time1 is passed requires no I/O.
+  void set_prefetch_data(const bool prefetch) {
+      m_prefetch_data = prefetch;
+  }
+
   // Option to add a logger
   void set_logger(const std::shared_ptr<ekat::logger::LoggerBase>& logger,
                   const std::string& header) {
@@ -91,6 +97,7 @@ protected:
   int                                        m_triplet_idx;
   AtmosphereInput                            m_file_data_atm_input;
   bool                                       m_is_data_from_file=false;
+  bool                                       m_prefetch_data=false;
 
   std::shared_ptr<ekat::logger::LoggerBase>  m_logger;
   std::string                                m_header;
@@ -1,9 +1,78 @@
 #include "share/util/scream_timing.hpp"
 
+#include <ekat/ekat_assert.hpp>
+
 #include <gptl.h>
 
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace scream {
 
+namespace {
+
+struct TimerEntry {
+  std::string name;
+  // GPTL's handle (a pointer to its internal timer struct). It is null until
+  // the first call to GPTLstart_handle, which sets it.
+  void* gptl_handle = nullptr;
+};
+
+struct TraceEvent {
+  int    timer;
+  char   phase;   // 'B' (begin) or 'E' (end)
+  double ts;      // Microseconds since the trace was enabled
+};
+
+struct TimersRegistry {
+  std::vector<TimerEntry>               timers;
+  std::unordered_map<std::string,int>   name_to_handle;
+  std::mutex                            registry_mutex;
+
+  // Trace data
+  using clock_t = std::chrono::steady_clock;
+  bool                    trace_enabled = false;
+  clock_t::time_point     trace_t0;
+  std::vector<TraceEvent> events;
+  long long               num_dropped_events = 0;
+  std::mutex              trace_mutex;
+};
+
+TimersRegistry& get_registry () {
+  static TimersRegistry r;
+  return r;
+}
+
+void record_event (TimersRegistry& r, const int handle, const char phase) {
+  using namespace std::chrono;
+  const double ts = duration<double,std::micro>(TimersRegistry::clock_t::now()-r.trace_t0).count();
+
+  std::lock_guard<std::mutex> lock(r.trace_mutex);
+  if (r.events.size()<r.events.capacity()) {
+    r.events.push_back(TraceEvent{handle,phase,ts});
+  } else {
+    ++r.num_dropped_events;
+  }
+}
+
+// Escape the few chars that could appear in a timer name and break json syntax
+std::string json_escape (const std::string& s) {
+  std::string out;
+  out.reserve(s.size());
+  for (const char c : s) {
+    if (c=='"' || c=='\\') {
+      out += '\\';
+    }
+    out += c;
+  }
+  return out;
+}
+
+} // anonymous namespace
+
 void init_gptl (bool& was_already_inited) {
 #ifdef SCREAM_CIME_BUILD
   was_already_inited = true;
@@ -14,18 +83,127 @@ void init_gptl (bool& was_already_inited) {
 }
 void finalize_gptl () {
   GPTLfinalize();
+
+  // GPTL's handles are no longer valid
+  for (auto& t : get_registry().timers) {
+    t.gptl_handle = nullptr;
+  }
 }
 
 void start_timer (const std::string& name) {
-  GPTLstart(name.c_str());
+  start_timer(register_timer(name));
 }
 
 void stop_timer (const std::string& name) {
-  GPTLstop(name.c_str());
+  stop_timer(register_timer(name));
+}
+
+int register_timer (const std::string& name) {
+  auto& r = get_registry();
+  std::lock_guard<std::mutex> lock(r.registry_mutex);
+
+  auto it = r.name_to_handle.find(name);
+  if (it!=r.name_to_handle.end()) {
+    return it->second;
+  }
+
+  const int handle = r.timers.size();
+  r.timers.push_back(TimerEntry{name,nullptr});
+  r.name_to_handle.emplace(name,handle);
+  return handle;
+}
+
+void start_timer (const int handle) {
+  auto& r = get_registry();
+  EKAT_ASSERT_MSG (handle>=0 && handle<static_cast<int>(r.timers.size()),
+      "Error! Invalid timer handle: " + std::to_string(handle) + "\n");
+
+  auto& t = r.timers[handle];
+  GPTLstart_handle(t.name.c_str(),&t.gptl_handle);
+  if (r.trace_enabled) {
+    record_event(r,handle,'B');
+  }
+}
+
+void stop_timer (const int handle) {
+  auto& r = get_registry();
+  EKAT_ASSERT_MSG (handle>=0 && handle<static_cast<int>(r.timers.size()),
+      "Error! Invalid timer handle: " + std::to_string(handle) + "\n");
+
+  auto& t = r.timers[handle];
+  if (r.trace_enabled) {
+    record_event(r,handle,'E');
+  }
+  GPTLstop_handle(t.name.c_str(),&t.gptl_handle);
+}
+
+const std::string& get_timer_name (const int handle) {
+  const auto& r = get_registry();
+  EKAT_REQUIRE_MSG (handle>=0 && handle<static_cast<int>(r.timers.size()),
+      "Error! Invalid timer handle: " + std::to_string(handle) + "\n");
+  return r.timers[handle].name;
 }
 
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname) {
   GPTLpr_summary_file (comm.mpi_comm(),fname.c_str());
 }
 
+void enable_timers_trace (const int max_num_events) {
+  EKAT_REQUIRE_MSG (max_num_events>0,
+      "Error! Invalid max number of timers trace events.\n"
+      "  - max_num_events: " + std::to_string(max_num_events) + "\n");
+
+  auto& r = get_registry();
+  std::lock_guard<std::mutex> lock(r.trace_mutex);
+  if (r.trace_enabled) {
+    return;
+  }
+  r.events.clear();
+  r.events.reserve(max_num_events);
+  r.num_dropped_events = 0;
+  r.trace_t0 = TimersRegistry::clock_t::now();
+  r.trace_enabled = true;
+}
+
+bool is_timers_trace_enabled () {
+  return get_registry().trace_enabled;
+}
+
+void write_timers_trace (const ekat::Comm& comm, const std::string& prefix) {
+  auto& r = get_registry();
+  EKAT_REQUIRE_MSG (r.trace_enabled,
+      "Error! Cannot write timers trace, since the trace was never enabled.\n");
+
+  const auto fname = prefix + "." + std::to_string(comm.rank()) + ".json";
+  std::ofstream ofile(fname);
+  EKAT_REQUIRE_MSG (ofile.good(),
+      "Error! Could not open timers trace file.\n"
+      "  - file name: " + fname + "\n");
+
+  std::lock_guard<std::mutex> lock(r.trace_mutex);
+
+  // Escape names once, rather than once per event
+  std::vector<std::string> names;
+  {
+    std::lock_guard<std::mutex> lock_reg(r.registry_mutex);
+    for (const auto& t : r.timers) {
+      names.push_back(json_escape(t.name));
+    }
+  }
+
+  const int pid = comm.rank();
+  ofile << "{\"traceEvents\":[\n";
+  ofile << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":0,"
+        << "\"args\":{\"name\":\"rank " << pid << "\"}}";
+  ofile.precision(3);
+  ofile << std::fixed;
+  for (const auto& e : r.events) {
+    ofile << ",\n{\"name\":\"" << names[e.timer] << "\",\"ph\":\"" << e.phase << "\","
+          << "\"ts\":" << e.ts << ",\"pid\":" << pid << ",\"tid\":0}";
+  }
+  ofile << "\n],\n";
+  ofile << "\"displayTimeUnit\":\"ms\",\n";
+  ofile << "\"otherData\":{\"num_dropped_events\":" << r.num_dropped_events << "}}\n";
+}
+
 } // namespace scream
@@ -15,8 +15,32 @@ void finalize_gptl ();
 void start_timer (const std::string& name);
 void stop_timer (const std::string& name);
 
+// Handle-based timers. A timer is registered once (which is when its name is
+// hashed), and the returned handle can then be used to start/stop it.
+// Starting/stopping a timer via its handle does not allocate any memory, and
+// skips the name lookup inside GPTL, which makes these the preferred choice for
+// timers that are called at every time step.
+// Note: registering the same name twice returns the same handle.
+// Note: like the string-based version, these are meant to be called from the
+//       master thread (i.e., not from within a threaded region).
+int register_timer (const std::string& name);
+void start_timer (const int handle);
+void stop_timer (const int handle);
+const std::string& get_timer_name (const int handle);
+
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname);
 
+// Optional trace of timer events. When enabled, every start/stop call records
+// a (timer, begin/end, time stamp) event, which can be written to a json file in
+// the Chrome trace event format (readable, e.g., by Perfetto or chrome://tracing).
+// Events are stored in a buffer of fixed size, allocated upon enabling the
+// trace; once the buffer is full, further events are discarded (and counted).
+void enable_timers_trace (const int max_num_events = 1000000);
+bool is_timers_trace_enabled ();
+
+// Write the trace events of this rank to the file <prefix>.<rank>.json
+void write_timers_trace (const ekat::Comm& comm, const std::string& prefix);
+
 } // namespace scream
 
 #endif // SCREAM_TIMING_HPP
@@ -2,11 +2,16 @@
 #define SCREAM_VERTICAL_INTERPOLATION_HPP
 
 #include "share/scream_types.hpp"
+#include "share/field/field.hpp"
 
 #include "ekat/util/ekat_lin_interp.hpp"
 #include "ekat/ekat_pack_utils.hpp"
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 
+#include <map>
+#include <memory>
+#include <vector>
+
 namespace scream {
 namespace vinterp {
 
@@ -27,6 +32,12 @@ namespace vinterp {
  * There is a function, perform_vertical_interpolation_impl_1d which 
  * is provided for 1d views (or lambdas). However, in this 
  * case the user must provide the team and ekat::LinInterp as input as well.
+ *
+ * When several variables are interpolated from the same source levels onto
+ * the same target levels, the user can compute a VertInterpPlan once, and
+ * pass it to perform_vertical_interpolation in place of x_tgt. The plan
+ * stores the result of the bracket search (the LinInterp setup), so that
+ * it is not repeated for each variable.
  */
 
 // ------- Types --------
@@ -146,6 +157,60 @@ void perform_vertical_interpolation(
   const int nlevs_tgt,
   const Real msk_val = masked_val);
 
+/* ----------------------------------------------------------------------
+ * Interpolation plan from a 2-D source coordinate onto a set of target
+ * levels (the same for all columns). The plan owns a copy of the target
+ * levels, and the ekat::LinInterp object that stores the bracket indices.
+ * ---------------------------------------------------------------------- */
+template<typename T, int P>
+class VertInterpPlan {
+public:
+  VertInterpPlan (const int ncols, const int nlevs_src, const std::vector<T>& tgt_levs);
+
+  // Perform the bracket search of the target levels in each column of x_src
+  void setup (const view_2d<const Pack<T,P>>& x_src);
+
+  int num_cols     () const { return m_ncols; }
+  int num_levs_src () const { return m_nlevs_src; }
+  int num_levs_tgt () const { return m_nlevs_tgt; }
+
+  const view_1d<const Pack<T,P>>& get_x_tgt () const { return m_x_tgt; }
+  const LIV<T,P>& get_lin_interp () const { return m_vert_interp; }
+
+protected:
+  int                       m_ncols;
+  int                       m_nlevs_src;
+  int                       m_nlevs_tgt;
+  view_1d<const Pack<T,P>>  m_x_tgt;
+  LIV<T,P>                  m_vert_interp;
+};
+
+template<typename T, int P, int N>
+void perform_vertical_interpolation(
+  const view_2d<const Pack<T,P>>&   x_src,
+  const VertInterpPlan<T,P>&        plan,
+  const view_Nd<const Pack<T,P>,N>& input,
+  const view_Nd<      Pack<T,P>,N>& output,
+  const Real msk_val = masked_val);
+
+template<typename T, int P, int N>
+void perform_vertical_interpolation(
+  const view_2d<const Pack<T,P>>&   x_src,
+  const VertInterpPlan<T,P>&        plan,
+  const view_Nd<const Pack<T,P>,N>& input,
+  const view_Nd<      Pack<T,P>,N>& output,
+  const view_Nd<      Mask<P>,N>&   mask,
+  const Real msk_val = masked_val);
+
+// Get the plan to interpolate from the vertical coordinate field x_src (a
+// COLxLEV or COLxILEV field) onto the levels tgt_levs. Plans are stored in
+// the header of x_src, so that all the users of the same coordinate field
+// (e.g., several FieldAtPressureLevel diagnostics) share them. A plan is
+// only recomputed if the time stamp of x_src changed since its last setup.
+template<int P>
+std::shared_ptr<const VertInterpPlan<Real,P>>
+get_vertical_interpolation_plan (const Field& x_src, const std::vector<Real>& tgt_levs);
+
 /* ---------------------------------------------------------------------- 
  * Main interpolation routine that applies vertical interpolation to a
  * single vertical slice of data. 
@@ -163,7 +228,8 @@ void apply_interpolation_impl_1d(
   const int icol,
   const T msk_val,
   const MemberType& team,
-  const LIV<T,P>& vert_interp);
+  const LIV<T,P>& vert_interp,
+  const bool do_setup = true);
 
 /* ---------------------------------------------------------------------- 
  * Versions where x_src is a 2-D view and x_tgt is a 2-D view
@@ -223,7 +289,8 @@ void apply_interpolation(
   const view_1d<const Pack<T,P>>& x_tgt,
   const view_2d<const Pack<T,P>>& input,
   const view_2d<      Pack<T,P>>& output,
-  const view_2d<        Mask<P>>& mask);
+  const view_2d<        Mask<P>>& mask,
+  const bool do_setup = true);
 
 template<typename T, int P> 
 void apply_interpolation(
@@ -235,7 +302,8 @@ void apply_interpolation(
   const view_1d<const Pack<T,P>>& x_tgt,
   const view_3d<const Pack<T,P>>& input,
   const view_3d<      Pack<T,P>>& output,
-  const view_3d<        Mask<P>>& mask);
+  const view_3d<        Mask<P>>& mask,
+  const bool do_setup = true);
 
 /* ---------------------------------------------------------------------- 
  * Versions where x_src is a 1-D view and x_tgt is a 2-D view
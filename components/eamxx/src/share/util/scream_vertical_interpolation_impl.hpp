@@ -31,7 +31,8 @@ void apply_interpolation_impl_1d(
   const int icol,
   const T msk_val,
   const MemberType& team,
-  const LIV<T,P>& vert_interp)
+  const LIV<T,P>& vert_interp,
+  const bool do_setup)
 {
   // Recast source views to support different packsizes
   using PackInfo = ekat::PackInfo<P>;
@@ -49,8 +50,10 @@ void apply_interpolation_impl_1d(
   EKAT_KERNEL_REQUIRE_MSG(x_tgt.size() == output.size(), "Error! vertical_interpolation::apply_interpolation_imple_1d - target pressure level size does not match the size of the target data output.");
   EKAT_KERNEL_REQUIRE_MSG(x_src.size() == input.size() , "Error! vertical_interpolation::apply_interpolation_imple_1d - source pressure level size does not match the size of the source data input.");
 
-  //Setup linear interpolation
-  vert_interp.setup(team, x_src, x_tgt);
+  //Setup linear interpolation (unless it was already done, e.g. via VertInterpPlan)
+  if (do_setup) {
+    vert_interp.setup(team, x_src, x_tgt);
+  }
   //Run linear interpolation
   vert_interp.lin_interp(team, x_src, x_tgt, input, output, icol);
   const auto x_src_s = ekat::scalarize(x_src);
@@ -296,7 +299,8 @@ void apply_interpolation(
   const view_1d<const Pack<T,P>>& x_tgt,
   const view_2d<const Pack<T,P>>& input,
   const view_2d<      Pack<T,P>>& output,
-  const view_2d<        Mask<P>>& mask_out)
+  const view_2d<        Mask<P>>& mask_out,
+  const bool do_setup)
 {
   const int d_0      = input.extent_int(0);
   const int npacks   = output.extent_int(output.rank-1);
@@ -310,7 +314,7 @@ void apply_interpolation(
     const auto out  = ekat::subview(output, icol);
     const auto mask = ekat::subview(mask_out, icol);
     
-    apply_interpolation_impl_1d<T,P>(x1,x_tgt,in,out,mask,num_levs_src,num_levs_tgt,icol,mask_val,team,vert_interp);
+    apply_interpolation_impl_1d<T,P>(x1,x_tgt,in,out,mask,num_levs_src,num_levs_tgt,icol,mask_val,team,vert_interp,do_setup);
   });
   Kokkos::fence();
 }
@@ -325,7 +329,8 @@ void apply_interpolation(
   const view_1d<const Pack<T,P>>& x_tgt,
   const view_3d<const Pack<T,P>>& input,
   const view_3d<      Pack<T,P>>& output,
-  const view_3d<        Mask<P>>& mask_out)
+  const view_3d<        Mask<P>>& mask_out,
+  const bool do_setup)
 {
   const int d_0      = input.extent_int(0);
   const int num_vars = input.extent_int(1);
@@ -341,7 +346,9 @@ void apply_interpolation(
     const auto out  = ekat::subview(output, icol, ivar);
     const auto mask = ekat::subview(mask_out, icol, ivar);
 
-    apply_interpolation_impl_1d<T,P>(x1,x_tgt,in,out,mask,num_levs_src,num_levs_tgt,team.league_rank(),mask_val,team,vert_interp);
+    // A precomputed setup (e.g., from a VertInterpPlan) has one entry per column
+    const int idof = do_setup ? team.league_rank() : icol;
+    apply_interpolation_impl_1d<T,P>(x1,x_tgt,in,out,mask,num_levs_src,num_levs_tgt,idof,mask_val,team,vert_interp,do_setup);
   });
   Kokkos::fence();   
 }
@@ -621,7 +628,123 @@ void apply_interpolation(
   });
   Kokkos::fence();   
 }
-  
+
+/* ----------------------------------------------------------------------
+ * Interpolation plans
+ * ---------------------------------------------------------------------- */
+template<typename T, int P>
+VertInterpPlan<T,P>::
+VertInterpPlan (const int ncols, const int nlevs_src, const std::vector<T>& tgt_levs)
+ : m_ncols (ncols)
+ , m_nlevs_src (nlevs_src)
+ , m_nlevs_tgt (tgt_levs.size())
+ , m_vert_interp (ncols,nlevs_src,tgt_levs.size())
+{
+  EKAT_REQUIRE_MSG (m_nlevs_tgt>0,
+      "Error! VertInterpPlan requires at least one target level.\n");
+
+  // Fill padding entries with the last level, so they are valid pressure values
+  view_1d<Pack<T,P>> x_tgt("",ekat::PackInfo<P>::num_packs(m_nlevs_tgt));
+  auto x_tgt_h = Kokkos::create_mirror_view(x_tgt);
+  auto x_tgt_s = ekat::scalarize(x_tgt_h);
+  for (int k=0; k<static_cast<int>(x_tgt_s.size()); ++k) {
+    x_tgt_s(k) = tgt_levs[std::min(k,m_nlevs_tgt-1)];
+  }
+  Kokkos::deep_copy(x_tgt,x_tgt_h);
+  m_x_tgt = x_tgt;
+}
+
+template<typename T, int P>
+void VertInterpPlan<T,P>::
+setup (const view_2d<const Pack<T,P>>& x_src)
+{
+  EKAT_REQUIRE(x_src.extent_int(0) == m_ncols);
+  EKAT_REQUIRE(m_nlevs_src <= x_src.extent_int(1)*P);
+
+  using PackInfo = ekat::PackInfo<P>;
+  const int num_src_packs = PackInfo::num_packs(m_nlevs_src);
+  const int num_tgt_packs = m_x_tgt.extent_int(0);
+  const auto x_tgt = m_x_tgt;
+  const auto vert_interp = m_vert_interp;
+  const auto policy = ESU::get_default_team_policy(m_ncols, num_tgt_packs);
+  Kokkos::parallel_for("scream_vert_interp_plan_setup", policy,
+               KOKKOS_LAMBDA(MemberType const& team) {
+    const int  icol = team.league_rank();
+    const auto x1   = Kokkos::subview(ekat::subview(x_src,icol),Kokkos::pair<int,int>(0,num_src_packs));
+    vert_interp.setup(team, x1, x_tgt);
+  });
+  Kokkos::fence();
+}
+
+template<typename T, int P, int N>
+void perform_vertical_interpolation(
+  const view_2d<const Pack<T,P>>&   x_src,
+  const VertInterpPlan<T,P>&        plan,
+  const view_Nd<const Pack<T,P>,N>& input,
+  const view_Nd<      Pack<T,P>,N>& output,
+  const view_Nd<      Mask<P>,N>&   mask,
+  const Real msk_val)
+{
+  const int nlevs_src = plan.num_levs_src();
+  const int nlevs_tgt = plan.num_levs_tgt();
+  EKAT_REQUIRE(x_src.extent_int(0) == plan.num_cols());
+  perform_checks<T,P,N>(x_src, plan.get_x_tgt(), input, output, nlevs_src, nlevs_tgt);
+  apply_interpolation(nlevs_src, nlevs_tgt, msk_val, plan.get_lin_interp(), x_src, plan.get_x_tgt(), input, output, mask, false);
+}
+
+template<typename T, int P, int N>
+void perform_vertical_interpolation(
+  const view_2d<const Pack<T,P>>&   x_src,
+  const VertInterpPlan<T,P>&        plan,
+  const view_Nd<const Pack<T,P>,N>& input,
+  const view_Nd<      Pack<T,P>,N>& output,
+  const Real msk_val)
+{
+  std::vector<int> extents;
+  for (int ii=0;ii<output.rank;ii++) {
+    extents.push_back(output.extent_int(ii));
+  }
+  const auto mask = allocate_mask<P,N>(extents);
+
+  perform_vertical_interpolation<T,P,N>(x_src, plan, input, output, mask, msk_val);
+}
+
+template<int P>
+std::shared_ptr<const VertInterpPlan<Real,P>>
+get_vertical_interpolation_plan (const Field& x_src, const std::vector<Real>& tgt_levs)
+{
+  using plan_type  = VertInterpPlan<Real,P>;
+  using entry_type = std::pair<util::TimeStamp,std::shared_ptr<plan_type>>;
+  using cache_type = std::map<std::vector<Real>,entry_type>;
+
+  const auto& layout = x_src.get_header().get_identifier().get_layout();
+  EKAT_REQUIRE_MSG (layout.rank()==2,
+      "Error! Vertical interpolation plans require a 2D source coordinate field.\n"
+      " - field name: " + x_src.name() + "\n"
+      " - field layout: " + to_string(layout) + "\n");
+
+  // Plans are cached in the field header, so they are shared by all its copies
+  const std::string key = "vinterp plans P" + std::to_string(P);
+  auto fh = x_src.get_header_ptr();
+  if (not fh->has_extra_data(key)) {
+    fh->set_extra_data(key,std::make_shared<cache_type>());
+  }
+  auto& cache = *fh->get_extra_data<std::shared_ptr<cache_type>>(key);
+
+  auto& entry = cache[tgt_levs];
+  if (entry.second==nullptr) {
+    entry.second = std::make_shared<plan_type>(layout.dim(0),layout.dim(1),tgt_levs);
+  }
+
+  // Without a valid time stamp we cannot tell if x_src changed, so always redo the setup
+  const auto& ts = fh->get_tracking().get_time_stamp();
+  if (not ts.is_valid() or not (ts==entry.first)) {
+    entry.second->setup(x_src.get_view<const Pack<Real,P>**>());
+    entry.first = ts;
+  }
+  return entry.second;
+}
+
 } // namespace vinterp
 } // namespace scream
 
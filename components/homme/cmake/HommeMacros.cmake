@@ -111,11 +111,24 @@ macro(createTestExec execName execType macroNP macroNC
 
   ADD_DEFINITIONS(-DHAVE_CONFIG_H)
 
-  ADD_EXECUTABLE(${execName} ${EXEC_SOURCES})
+  # The node-aware rank mapping (node_aware_partition) is written in C++.
+  # HOMME_USE_CXX is not visible when the macro is called from outside Homme
+  # (e.g. the EAMxx dycore lib), but Kokkos builds always have C++.
+  IF (HOMME_USE_CXX OR HOMME_USE_KOKKOS)
+    SET(NODE_PARTITION_SRCS ${HOMME_SOURCE_DIR}/src/node_partition/node_partition.cpp)
+  ELSE ()
+    SET(NODE_PARTITION_SRCS)
+  ENDIF ()
+
+  ADD_EXECUTABLE(${execName} ${EXEC_SOURCES} ${NODE_PARTITION_SRCS})
   SET_TARGET_PROPERTIES(${execName} PROPERTIES LINKER_LANGUAGE Fortran)
   IF(BUILD_HOMME_WITHOUT_PIOLIBRARY)
     TARGET_COMPILE_DEFINITIONS(${execName} PUBLIC HOMME_WITHOUT_PIOLIBRARY)
   ENDIF()
+  # Only define it where node_partition.cpp is compiled in, or the link fails
+  IF (NODE_PARTITION_SRCS)
+    TARGET_COMPILE_DEFINITIONS(${execName} PUBLIC HOMME_USE_NODE_PARTITION)
+  ENDIF ()
   IF(BUILD_HOMMEXX_BENCHMARK_NOFORCING)
     TARGET_COMPILE_DEFINITIONS(${execName} PUBLIC HOMMEXX_BENCHMARK_NOFORCING)
   ENDIF()
@@ -232,13 +245,26 @@ macro(createExecLib libName execType libSrcs inclDirs macroNP
 
   ADD_DEFINITIONS(-DHAVE_CONFIG_H)
 
-  ADD_LIBRARY(${libName} ${libSrcs})
+  # The node-aware rank mapping (node_aware_partition) is written in C++.
+  # HOMME_USE_CXX is not visible when the macro is called from outside Homme
+  # (e.g. the EAMxx dycore lib), but Kokkos builds always have C++.
+  IF (HOMME_USE_CXX OR HOMME_USE_KOKKOS)
+    SET(NODE_PARTITION_SRCS ${HOMME_SOURCE_DIR}/src/node_partition/node_partition.cpp)
+  ELSE ()
+    SET(NODE_PARTITION_SRCS)
+  ENDIF ()
+
+  ADD_LIBRARY(${libName} ${libSrcs} ${NODE_PARTITION_SRCS})
   TARGET_INCLUDE_DIRECTORIES (${libName} PUBLIC ${inclDirs} ${modulesDir} ${CMAKE_CURRENT_BINARY_DIR})
   SET_TARGET_PROPERTIES(${libName} PROPERTIES Fortran_MODULE_DIRECTORY ${modulesDir})
   SET_TARGET_PROPERTIES(${libName} PROPERTIES LINKER_LANGUAGE Fortran)
   IF(BUILD_HOMME_WITHOUT_PIOLIBRARY)
     TARGET_COMPILE_DEFINITIONS(${libName} PUBLIC HOMME_WITHOUT_PIOLIBRARY)
   ENDIF()
+  # Only define it where node_partition.cpp is compiled in, or the link fails
+  IF (NODE_PARTITION_SRCS)
+    TARGET_COMPILE_DEFINITIONS(${libName} PUBLIC HOMME_USE_NODE_PARTITION)
+  ENDIF ()
 
   target_link_libraries(${execName} csm_share)
   if (NOT HOMME_BUILD_SCORPIO)
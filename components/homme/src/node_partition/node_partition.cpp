@@ -0,0 +1,140 @@
+#include "node_partition.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Node index of each rank in comm. Nodes are numbered in order of the lowest
+// rank they host.
+std::vector<int> get_rank2node (MPI_Comm comm) {
+  int rank, size;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+
+  MPI_Comm node_comm;
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_comm);
+  int leader = rank;
+  MPI_Allreduce(MPI_IN_PLACE, &leader, 1, MPI_INT, MPI_MIN, node_comm);
+  MPI_Comm_free(&node_comm);
+
+  std::vector<int> rank2leader(size);
+  MPI_Allgather(&leader, 1, MPI_INT, rank2leader.data(), 1, MPI_INT, comm);
+
+  // The leader is the lowest rank on its node, so it comes before all other
+  // ranks of its node.
+  std::vector<int> rank2node(size);
+  int nnodes = 0;
+  for (int r = 0; r < size; ++r)
+    rank2node[r] = rank2leader[r] == r ? nnodes++ : rank2node[rank2leader[r]];
+  return rank2node;
+}
+
+// Part-to-part graph: for each part, the number of GLL points it shares with
+// each other part.
+typedef std::vector<std::map<int,double> > PartGraph;
+
+PartGraph build_part_graph (const int nelem, const int* xadj, const int* adjncy,
+                            const double* adjwgt, const int nparts, const int* part) {
+  PartGraph pg(nparts);
+  for (int ie = 0; ie < nelem; ++ie) {
+    const int p = part[ie];
+    for (int j = xadj[ie]; j < xadj[ie+1]; ++j) {
+      const int q = part[adjncy[j]];
+      if (q != p) pg[p][q] += adjwgt[j];
+    }
+  }
+  return pg;
+}
+
+double calc_internode_wgt (const PartGraph& pg, const std::vector<int>& part2node) {
+  double wgt = 0;
+  for (size_t p = 0; p < pg.size(); ++p)
+    for (const auto& e : pg[p])
+      if (part2node[p] != part2node[e.first]) wgt += e.second;
+  return wgt;
+}
+
+// Fill the nodes in order. Each node's group is seeded with the lowest
+// unassigned part, which for a space-filling-curve partition is next to the
+// previous group, and then grows by the unassigned part with the largest
+// connection to the group.
+std::vector<int> group_parts (const PartGraph& pg, const std::vector<int>& node_cap) {
+  const int nparts = pg.size();
+  std::vector<int> part2node(nparts, -1);
+  std::vector<double> conn(nparts, 0);
+  // Ordered by decreasing connection, then increasing part, so the choice is
+  // the same on all ranks.
+  typedef std::pair<double,int> Candidate;
+  std::set<Candidate, std::function<bool(const Candidate&, const Candidate&)> >
+    cands([] (const Candidate& a, const Candidate& b) {
+      return a.first > b.first || (a.first == b.first && a.second < b.second);
+    });
+  std::vector<int> touched;
+  int seed = 0;
+  for (size_t n = 0; n < node_cap.size(); ++n) {
+    for (int k = 0; k < node_cap[n]; ++k) {
+      int p;
+      if (cands.empty()) {
+        while (part2node[seed] != -1) ++seed;
+        p = seed;
+      } else {
+        p = cands.begin()->second;
+        cands.erase(cands.begin());
+      }
+      part2node[p] = n;
+      for (const auto& e : pg[p]) {
+        const int q = e.first;
+        if (part2node[q] != -1) continue;
+        if (conn[q] == 0) touched.push_back(q);
+        else cands.erase(Candidate(conn[q], q));
+        conn[q] += e.second;
+        cands.insert(Candidate(conn[q], q));
+      }
+    }
+    cands.clear();
+    for (const int q : touched) conn[q] = 0;
+    touched.clear();
+  }
+  return part2node;
+}
+
+} // anon namespace
+
+extern "C"
+void node_partition_remap (
+  const int *nelem, const int *xadj, const int *adjncy, const double *adjwgt,
+  MPI_Fint *comm, int *part, double *internode_wgt_before, double *internode_wgt_after)
+{
+  const MPI_Comm c_comm = MPI_Comm_f2c(*comm);
+  const std::vector<int> rank2node = get_rank2node(c_comm);
+  const int nparts = rank2node.size();
+  const int nnodes = *std::max_element(rank2node.begin(), rank2node.end()) + 1;
+
+  std::vector<int> node_cap(nnodes, 0);
+  for (const int n : rank2node) ++node_cap[n];
+
+  const PartGraph pg = build_part_graph(*nelem, xadj, adjncy, adjwgt, nparts, part);
+  *internode_wgt_before = calc_internode_wgt(pg, rank2node);
+  *internode_wgt_after = *internode_wgt_before;
+  if (nnodes == 1) return;
+
+  const std::vector<int> part2node = group_parts(pg, node_cap);
+  const double wgt = calc_internode_wgt(pg, part2node);
+  if (wgt >= *internode_wgt_before) return;
+  *internode_wgt_after = wgt;
+
+  // Give the parts of each node the node's ranks, both in increasing order.
+  std::vector<std::vector<int> > node2ranks(nnodes);
+  for (int r = 0; r < nparts; ++r) node2ranks[rank2node[r]].push_back(r);
+  std::vector<int> part2rank(nparts), cnt(nnodes, 0);
+  for (int p = 0; p < nparts; ++p) {
+    const int n = part2node[p];
+    part2rank[p] = node2ranks[n][cnt[n]++];
+  }
+  for (int ie = 0; ie < *nelem; ++ie) part[ie] = part2rank[part[ie]];
+}
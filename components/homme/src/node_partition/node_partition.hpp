@@ -0,0 +1,37 @@
+#ifndef NODEPARTITIONHPP
+#define NODEPARTITIONHPP
+
+#include "mpi.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* Given an element partition into comm_size parts, reassign the parts to MPI
+   ranks so that parts sharing many edges are placed on the same node.
+
+   The element graph is in CSR form (0-based), with adjwgt the number of GLL
+   points shared by two elements. part(0:nelem-1) holds the 0-based part of each
+   element on input, and the 0-based rank of each element on output. Part p is
+   assumed to live on rank p on input, so the input itself is a valid mapping.
+
+   Parts are grouped into nodes by growing each node's group greedily, always
+   adding the unassigned part with the most shared points with the group. The
+   result is kept only if it reduces the inter-node cut.
+
+   internode_wgt_{before,after} get the sum of adjwgt over the element graph
+   edges whose endpoints are on different nodes (both directions counted), i.e.
+   the number of GLL points sent off node in an exchange of a 2D field. */
+void node_partition_remap(
+    const int *nelem,
+    const int *xadj,
+    const int *adjncy,
+    const double *adjwgt,
+    MPI_Fint *comm,
+    int *part,
+    double *internode_wgt_before,
+    double *internode_wgt_after);
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -43,6 +43,7 @@ CAAS<ES>::CAAS (const mpi::Parallel::Ptr& p, const Int nlclcells,
   o.nrhomidxs_ = 0;
   o.need_conserve_ = false;
   finished_setup_ = false;
+  reduce_pending_ = false;
   cedr_throw_if(nlclcells == 0, "CAAS does not support 0 cells on a rank.");
   tracer_decls_ = std::make_shared<std::vector<Decl> >();  
 }
@@ -208,6 +209,27 @@ void CAAS<ES>::reduce_globally () {
                 "CAAS::reduce_globally MPI_Allreduce returned " << err);
 }
 
+template <typename ES>
+void CAAS<ES>::reduce_globally_start () {
+  cedr_assert( ! reduce_pending_);
+  // send_ is filled by the kernels in reduce_locally.
+  Kokkos::fence();
+  const int err = mpi::iall_reduce(*p_, send_.data(), recv_.data(),
+                                   send_.size(), MPI_SUM, &reduce_req_);
+  cedr_throw_if(err != MPI_SUCCESS,
+                "CAAS::reduce_globally_start MPI_Iallreduce returned " << err);
+  reduce_pending_ = true;
+}
+
+template <typename ES>
+void CAAS<ES>::reduce_globally_finish () {
+  if ( ! reduce_pending_) return;
+  const int err = mpi::waitall(1, &reduce_req_);
+  cedr_throw_if(err != MPI_SUCCESS,
+                "CAAS::reduce_globally_finish MPI_Waitall returned " << err);
+  reduce_pending_ = false;
+}
+
 template <typename ES>
 void CAAS<ES>::finish_locally () {
   using ESU = cedr::impl::ExeSpaceUtils<ES>;
@@ -269,6 +291,25 @@ void CAAS<ES>::run () {
   finish_locally();
 }
 
+template <typename ES>
+void CAAS<ES>::run_start () {
+  cedr_assert(finished_setup_);
+  reduce_locally();
+  const bool user_reduces = user_reducer_ != nullptr;
+  if (user_reduces)
+    (*user_reducer_)(*p_, send_.data(), recv_.data(),
+                     o.nlclcells_ / user_reducer_->n_accum_in_place(),
+                     recv_.size(), MPI_SUM);
+  else
+    reduce_globally_start();
+}
+
+template <typename ES>
+void CAAS<ES>::run_finish () {
+  reduce_globally_finish();
+  finish_locally();
+}
+
 namespace test {
 struct TestCAAS : public cedr::test::TestRandomized {
   typedef CAAS<Kokkos::DefaultExecutionSpace> CAAST;
@@ -360,7 +401,13 @@ struct TestCAAS : public cedr::test::TestRandomized {
   }
 
   void run_impl (const Int trial) override {
-    caas_->run();
+    // Cover the split-phase API too.
+    if (external_memory_) {
+      caas_->run_start();
+      caas_->run_finish();
+    } else {
+      caas_->run();
+    }
   }
 
 private:
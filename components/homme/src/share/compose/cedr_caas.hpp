@@ -88,6 +88,12 @@ public:
 
   void run() override;
 
+  // If there is no UserAllReducer, run_start posts a nonblocking all-reduce of
+  // the tracer-mass sums, and run_finish waits for it. A UserAllReducer is
+  // always run in run_start.
+  void run_start() override;
+  void run_finish() override;
+
 protected:
   typedef cedr::impl::Unmanaged<RealList> UnmanagedRealList;
 
@@ -106,8 +112,12 @@ protected:
   RealList send_, recv_;
   bool finished_setup_;
   DeviceOp o;
+  mpi::Request reduce_req_;
+  bool reduce_pending_;
 
   void reduce_globally();
+  void reduce_globally_start();
+  void reduce_globally_finish();
 
 PRIVATE_CUDA:
   void reduce_locally();
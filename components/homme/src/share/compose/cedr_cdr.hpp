@@ -107,6 +107,14 @@ struct CDR {
   // call this function from a parallel region.
   virtual void run() = 0;
 
+  // Split-phase version of run: run_start() followed by run_finish() is
+  // equivalent to run(). An implementation may leave communication in flight
+  // between the two, so the caller can do unrelated work in the meantime. The
+  // CDR's data must not be accessed between the two calls. By default,
+  // run_start does all the work.
+  virtual void run_start() { run(); }
+  virtual void run_finish() {}
+
 protected:
   Options options_;
 };
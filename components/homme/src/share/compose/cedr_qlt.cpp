@@ -325,12 +325,16 @@ Int QLT<ES>::get_num_tracers () const {
 }
 
 template <typename ES> void QLT<ES>
-::l2r_recv (const tree::NodeSets::Level& lvl, const Int& l2rndps) const {
+::l2r_recv_start (const tree::NodeSets::Level& lvl, const Int& l2rndps) const {
   for (size_t i = 0; i < lvl.kids.size(); ++i) {
     const auto& mmd = lvl.kids[i];
     mpi::irecv(*p_, o.bd_.l2r_data.data() + mmd.offset*l2rndps, mmd.size*l2rndps,
                mmd.rank, tree::NodeSets::mpitag, &lvl.kids_req[i]);
   }
+}
+
+template <typename ES> void QLT<ES>
+::l2r_recv_finish (const tree::NodeSets::Level& lvl) const {
   Timer::start(Timer::waitall);
   mpi::waitall(lvl.kids_req.size(), lvl.kids_req.data());
   Timer::stop(Timer::waitall);
@@ -476,12 +480,16 @@ template <typename ES> void QLT<ES>
 }
 
 template <typename ES> void QLT<ES>
-::r2l_recv (const tree::NodeSets::Level& lvl, const Int& r2lndps) const {
+::r2l_recv_start (const tree::NodeSets::Level& lvl, const Int& r2lndps) const {
   for (size_t i = 0; i < lvl.me.size(); ++i) {
     const auto& mmd = lvl.me[i];
     mpi::irecv(*p_, o.bd_.r2l_data.data() + mmd.offset*r2lndps, mmd.size*r2lndps,
                mmd.rank, tree::NodeSets::mpitag, &lvl.me_recv_req[i]);
   }
+}
+
+template <typename ES> void QLT<ES>
+::r2l_recv_finish (const tree::NodeSets::Level& lvl) const {
   Timer::start(Timer::waitall);
   mpi::waitall(lvl.me_recv_req.size(), lvl.me_recv_req.data());
   Timer::stop(Timer::waitall);
@@ -622,17 +630,30 @@ void QLT<ES>::run () {
   // Number of data per slot.
   const Int l2rndps = o.md_.a_h.prob2bl2r[o.md_.nprobtypes];
   const Int r2lndps = o.md_.a_h.prob2br2l[o.md_.nprobtypes];
+  // Post the receives for all levels up front, so that messages for upper
+  // levels are in flight (and, if large, already being transferred) while the
+  // lower levels are processed. Each slot has its own buffer region. Messages
+  // from a given rank still match the receives in level order, since the
+  // sender sends them in level order, too.
+  for (const auto& lvl : ns_->levels)
+    if (lvl.kids.size()) l2r_recv_start(lvl, l2rndps);
   for (size_t il = 0; il < ns_->levels.size(); ++il) {
     auto& lvl = ns_->levels[il];
-    if (lvl.kids.size()) l2r_recv(lvl, l2rndps);
+    if (lvl.kids.size()) l2r_recv_finish(lvl);
     l2r_combine_kid_data(il, l2rndps);    
     if (lvl.me.size()) l2r_send_to_parents(lvl, l2rndps);
   }
   Timer::stop(Timer::qltrunl2r); Timer::start(Timer::qltrunr2l);
+  // Same for the r2l pass. All l2r messages to this rank have been received,
+  // so these receives can't match any of them.
+  for (size_t il = ns_->levels.size(); il > 0; --il) {
+    const auto& lvl = ns_->levels[il-1];
+    if (lvl.me.size()) r2l_recv_start(lvl, r2lndps);
+  }
   root_compute(l2rndps, r2lndps);
   for (size_t il = ns_->levels.size(); il > 0; --il) {
     auto& lvl = ns_->levels[il-1];
-    if (lvl.me.size()) r2l_recv(lvl, r2lndps);
+    if (lvl.me.size()) r2l_recv_finish(lvl);
     r2l_solve_qp(il-1, l2rndps, r2lndps);
     if (lvl.kids.size()) r2l_send_to_kids(lvl, r2lndps);
   }
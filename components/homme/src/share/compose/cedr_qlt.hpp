@@ -209,11 +209,13 @@ protected:
   DeviceOp o;
 
 PRIVATE_CUDA:
-  void l2r_recv(const tree::NodeSets::Level& lvl, const Int& l2rndps) const;
+  void l2r_recv_start(const tree::NodeSets::Level& lvl, const Int& l2rndps) const;
+  void l2r_recv_finish(const tree::NodeSets::Level& lvl) const;
   void l2r_combine_kid_data(const Int& lvlidx, const Int& l2rndps) const;
   void l2r_send_to_parents(const tree::NodeSets::Level& lvl, const Int& l2rndps) const;
   void root_compute(const Int& l2rndps, const Int& r2lndps) const;
-  void r2l_recv(const tree::NodeSets::Level& lvl, const Int& r2lndps) const;
+  void r2l_recv_start(const tree::NodeSets::Level& lvl, const Int& r2lndps) const;
+  void r2l_recv_finish(const tree::NodeSets::Level& lvl) const;
   void r2l_solve_qp(const Int& lvlidx, const Int& l2rndps, const Int& r2lndps) const;
   void r2l_send_to_kids(const tree::NodeSets::Level& lvl, const Int& r2lndps) const;
 };
@@ -23,6 +23,8 @@ struct CAAS : public cedr::caas::CAAS<Kokkos::Serial> {
   {}
 
   void run () override { run_horiz_omp(); }
+  void run_start () override { run_horiz_omp(); }
+  void run_finish () override {}
 
 private:
   void run_horiz_omp();
@@ -45,7 +45,10 @@ static void run_cdr (CDR<MT>& q) {
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
 #endif
-  q.cdr->run();
+  // Use the split-phase run. Nothing is overlapped with the CDR's communication
+  // yet, but this is where work independent of the CDR would go.
+  q.cdr->run_start();
+  q.cdr->run_finish();
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
 #endif
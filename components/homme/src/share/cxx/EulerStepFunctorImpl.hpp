@@ -18,6 +18,7 @@
 #include "HybridVCoord.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "ThreadsTuner.hpp"
 #include "Tracers.hpp"
 #include "profiling.hpp"
 #include "mpi/BoundaryExchange.hpp"
@@ -255,10 +256,13 @@ public:
     }
 
     {
+      // The neighbor min/max of qlim is batched with the biharmonic exchange,
+      // so that each neighbor gets a single message for both
       m_mmqb_be = std::make_shared<BoundaryExchange>();
       m_mmqb_be->set_buffers_manager(bm_exchange);
-      m_mmqb_be->set_num_fields(0, 0, m_data.qsize);
+      m_mmqb_be->set_num_fields(m_data.qsize, 0, m_data.qsize);
       m_mmqb_be->register_field(m_tracers.qtens_biharmonic, m_data.qsize, 0);
+      m_mmqb_be->register_min_max_fields(m_tracers.qlim, m_data.qsize, 0);
       m_mmqb_be->registration_completed();
     }
 
@@ -423,13 +427,24 @@ public:
       *this);
     Kokkos::fence();
     m_kernel_will_run_limiters = true;
-    Kokkos::parallel_for(
-      //to play with launch bounds
-      //Homme::get_default_team_policy<ExecSpace, AALTracerPhase, Kokkos::LaunchBounds<128,1> >(
-      Homme::get_default_team_policy<ExecSpace, AALTracerPhase >(
-        m_geometry.num_elems() * m_data.qsize, m_tpref),
-      *this);
+    //to play with launch bounds
+    //Homme::get_default_team_policy<ExecSpace, AALTracerPhase, Kokkos::LaunchBounds<128,1> >(
+    auto policy = Homme::get_default_team_policy<ExecSpace, AALTracerPhase >(
+        m_geometry.num_elems() * m_data.qsize, m_tpref);
+
+    // Let the tuner pick the team size. m_tu_ne_qsize must match the policy
+    // we launch, and is restored afterwards for the other kernels using it.
+    auto& tuner = Context::singleton().create_if_not_there<ThreadsTuner>();
+    policy = ThreadsTuner::with_team_size(policy,
+        tuner.team_size("euler_step", policy.league_size(), policy.team_size()));
+    const auto tu_ne_qsize = m_tu_ne_qsize;
+    m_tu_ne_qsize = TeamUtils<ExecSpace>(policy);
+
+    tuner.start("euler_step");
+    Kokkos::parallel_for(policy, *this);
     Kokkos::fence();
+    tuner.stop("euler_step");
+    m_tu_ne_qsize = tu_ne_qsize;
     m_kernel_will_run_limiters = false;
     profiling_pause();
   }
@@ -578,21 +593,12 @@ public:
     Kokkos::fence();
   }
 
-  void neighbor_minmax_start() {
-    assert(m_mm_be->is_registration_completed());
-    m_mm_be->pack_and_send_min_max();
-  }
-
-  void neighbor_minmax_finish() {
-    m_mm_be->recv_and_unpack_min_max();
-  }
-
   void minmax_and_biharmonic() {
-    neighbor_minmax_start();
     compute_biharmonic_pre();
+    // Also performs the neighbor min/max of qlim (untouched by the biharmonic)
+    assert(m_mmqb_be->is_registration_completed());
     m_mmqb_be->exchange(m_geometry.m_rspheremp);
     compute_biharmonic_post();
-    neighbor_minmax_finish();
   }
 
   void neighbor_minmax() {
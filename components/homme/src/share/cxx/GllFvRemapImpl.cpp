@@ -72,6 +72,12 @@ void GllFvRemapImpl::reset (const SimulationParams& params) {
   m_tu_ne_qsize = TeamUtils<ExecSpace>(m_tp_ne_qsize);
   m_tu_ne_dss = TeamUtils<ExecSpace>(m_tp_ne_dss);
 
+  // On CPU, the element and tracer kernels run as one per-element kernel, so
+  // the element's dp and geometry data are reused across all tracers while
+  // hot in cache, and there is one pass over the elements instead of two. On
+  // GPU, (element, tracer) teams expose much more parallelism.
+  m_data.fuse_tracers = ! OnGpu<ExecSpace>::value;
+
   if (Context::singleton().get<Connectivity>().get_comm().root())
     printf("gfr> nelemd %d qsize %d\n", m_data.nelemd, m_data.qsize);
 }
@@ -408,7 +414,26 @@ void GllFvRemapImpl
   EquationOfState eos; eos.init(theta_hydrostatic_mode, hvcoord);
   ElementOps ops; ops.init(hvcoord);
 
+  const auto dp_g = m_state.m_dp3d;
+  const auto remap_q = KOKKOS_LAMBDA (const KernelVariables& kv, const int ie, const int iq) {
+    const auto all = Kokkos::ALL();
+    const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
+    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
+
+    const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
+      gll_metdet_ie(&gll_metdet(ie,0,0), np2);
+    const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
+    
+    // q
+    g2f_mixing_ratio(
+      kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
+      evucs_np2_nlev(&dp_g(ie,timeidx,0,0,0)), dp_fv_ie, evucs_np2_nlev(&q_g(ie,iq,0,0,0)),
+      evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()), iq,
+      evus3(&q(ie,0,0,0), q.extent_int(1), q.extent_int(2), q.extent_int(3)));
+  };
+
   const auto tu_ne = m_tu_ne;
+  const bool fuse_tracers = m_data.fuse_tracers;
 
   const auto fe = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, tu_ne);
@@ -527,30 +552,22 @@ void GllFvRemapImpl
     remapd(team, nf2, np2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
            evucs_np2_nlev(&omega_g(ie,0,0,0)), evus_np2_nlev(rw1.data()),
            evus2(&omega(ie,0,0), nf2, nlevpk));
+
+    if (fuse_tracers) {
+      for (int iq = 0; iq < qsize; ++iq) {
+        kv.team_barrier();
+        remap_q(kv, ie, iq);
+      }
+    }
   };
   Kokkos::fence();
   Kokkos::parallel_for(m_tp_ne, fe);
+  if (fuse_tracers) return;
 
-  const auto dp_g = m_state.m_dp3d;
   const auto tu_ne_qsize = m_tu_ne_qsize;
   const auto feq = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, qsize, tu_ne_qsize);
-    const auto ie = kv.ie, iq = kv.iq;
-
-    const auto all = Kokkos::ALL();
-    const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
-    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
-
-    const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
-      gll_metdet_ie(&gll_metdet(ie,0,0), np2);
-    const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
-    
-    // q
-    g2f_mixing_ratio(
-      kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
-      evucs_np2_nlev(&dp_g(ie,timeidx,0,0,0)), dp_fv_ie, evucs_np2_nlev(&q_g(ie,iq,0,0,0)),
-      evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()), iq,
-      evus3(&q(ie,0,0,0), q.extent_int(1), q.extent_int(2), q.extent_int(3)));
+    remap_q(kv, kv.ie, kv.iq);
   };
   Kokkos::fence();
   Kokkos::parallel_for(m_tp_ne_qsize, feq);
@@ -608,7 +625,60 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
   const bool theta_hydrostatic_mode = m_data.theta_hydrostatic_mode;
   EquationOfState eos; eos.init(theta_hydrostatic_mode, hvcoord);
   ElementOps ops; ops.init(hvcoord);
+
+  const auto dp_g = m_state.m_dp3d;
+  const auto q_g = m_tracers.Q;
+  const auto fq = m_tracers.fq;
+  const auto qlim = m_tracers.qlim;
+
+  const auto remap_q = KOKKOS_LAMBDA (const KernelVariables& kv, const int ie, const int iq) {
+    const auto ttrf = Kokkos::TeamThreadRange(kv.team, nf2);
+    const auto ttrg = Kokkos::TeamThreadRange(kv.team, np2);
+    const auto tvr  = Kokkos::ThreadVectorRange(kv.team, nlevpk);
+    const auto all  = Kokkos::ALL();
+
+    const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
+    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
+    const auto r2w = Kokkos::subview(buf20, kv.team_idx, all, all, all, all);
+
+    const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
+      gll_metdet_ie(&gll_metdet(ie,0,0), np2);
+    const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
+
+    {
+      // Get limiter bounds.
+      const evus2 qf_ie(&r2w(1,0,0,0), nf2, nlevpk);
+      loop_ik(ttrf, tvr, [&] (int i, int k) { qf_ie(i,k) = q(ie,i,iq,k); });
+      kv.team_barrier();
+      calc_extrema(kv, nf2, nlevpk, qf_ie,
+                   evus1(&qlim(ie,iq,0,0), nlevpk), evus1(&qlim(ie,iq,1,0), nlevpk));
+      kv.team_barrier();
+      // FV Q_ten
+      //   GLL Q0 -> FV Q0
+      const evus2 dqf_ie(&r2w(0,0,0,0), nf2, nlevpk);
+      const evucs_np2_nlev dp_g_ie(&dp_g(ie,timeidx,0,0,0)), qg_ie(&q_g(ie,iq,0,0,0));
+      g2f_mixing_ratio(
+        kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie,
+        w_ff, fv_metdet_ie, dp_g_ie, dp_fv_ie, qg_ie,
+        evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()),
+        0, evus3(dqf_ie.data(), nf2, 1, nlevpk));
+      kv.team_barrier();
+      //   FV Q_ten = FV Q1 - FV Q0
+      loop_ik(ttrf, tvr, [&] (int i, int k) { dqf_ie(i,k) = qf_ie(i,k) - dqf_ie(i,k); });
+      kv.team_barrier();
+      // GLL Q_ten
+      const evus_np2_nlev dqg_ie(rw2.data());
+      f2g_scalar_dp(kv, nf2, np2, nlevpk, f2g_remapd, fv_metdet_ie, gll_metdet_ie,
+                    dp_fv_ie, dp_g_ie, dqf_ie, evus_np2_nlev(rw1.data()), dqg_ie);
+      kv.team_barrier();
+      // GLL Q1
+      const evus_np2_nlev fq_ie(&fq(ie,iq,0,0,0));
+      loop_ik(ttrg, tvr, [&] (int i, int k) { fq_ie(i,k) = qg_ie(i,k) + dqg_ie(i,k); });
+    }
+  };
+
   const auto tu_ne = m_tu_ne;
+  const bool fuse_tracers = m_data.fuse_tracers;
 
   const auto fe = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, tu_ne);
@@ -695,72 +765,31 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
       };
       parallel_for(ttrg, f2);
     }
+
+    if (fuse_tracers) {
+      for (int iq = 0; iq < qsize; ++iq) {
+        kv.team_barrier();
+        remap_q(kv, ie, iq);
+      }
+    }
   };
   Kokkos::fence();
   parallel_for(m_tp_ne, fe);
 
-  const auto dp_g = m_state.m_dp3d;
-  const auto q_g = m_tracers.Q;
-  const auto fq = m_tracers.fq;
-  const auto qlim = m_tracers.qlim;
   const auto tu_ne_qsize = m_tu_ne_qsize;
-
-  const auto feq = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, qsize, tu_ne_qsize);
-    const auto ie = kv.ie, iq = kv.iq;
-    const auto ttrf = Kokkos::TeamThreadRange(kv.team, nf2);
-    const auto ttrg = Kokkos::TeamThreadRange(kv.team, np2);
-    const auto tvr  = Kokkos::ThreadVectorRange(kv.team, nlevpk);
-    const auto all  = Kokkos::ALL();
-
-    const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
-    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
-    const auto r2w = Kokkos::subview(buf20, kv.team_idx, all, all, all, all);
-
-    const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
-      gll_metdet_ie(&gll_metdet(ie,0,0), np2);
-    const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
-
-    {
-      // Get limiter bounds.
-      const evus2 qf_ie(&r2w(1,0,0,0), nf2, nlevpk);
-      loop_ik(ttrf, tvr, [&] (int i, int k) { qf_ie(i,k) = q(ie,i,iq,k); });
-      kv.team_barrier();
-      calc_extrema(kv, nf2, nlevpk, qf_ie,
-                   evus1(&qlim(ie,iq,0,0), nlevpk), evus1(&qlim(ie,iq,1,0), nlevpk));
-      kv.team_barrier();
-      // FV Q_ten
-      //   GLL Q0 -> FV Q0
-      const evus2 dqf_ie(&r2w(0,0,0,0), nf2, nlevpk);
-      const evucs_np2_nlev dp_g_ie(&dp_g(ie,timeidx,0,0,0)), qg_ie(&q_g(ie,iq,0,0,0));
-      g2f_mixing_ratio(
-        kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie,
-        w_ff, fv_metdet_ie, dp_g_ie, dp_fv_ie, qg_ie,
-        evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()),
-        0, evus3(dqf_ie.data(), nf2, 1, nlevpk));
-      kv.team_barrier();
-      //   FV Q_ten = FV Q1 - FV Q0
-      loop_ik(ttrf, tvr, [&] (int i, int k) { dqf_ie(i,k) = qf_ie(i,k) - dqf_ie(i,k); });
-      kv.team_barrier();
-      // GLL Q_ten
-      const evus_np2_nlev dqg_ie(rw2.data());
-      f2g_scalar_dp(kv, nf2, np2, nlevpk, f2g_remapd, fv_metdet_ie, gll_metdet_ie,
-                    dp_fv_ie, dp_g_ie, dqf_ie, evus_np2_nlev(rw1.data()), dqg_ie);
-      kv.team_barrier();
-      // GLL Q1
-      const evus_np2_nlev fq_ie(&fq(ie,iq,0,0,0));
-      loop_ik(ttrg, tvr, [&] (int i, int k) { fq_ie(i,k) = qg_ie(i,k) + dqg_ie(i,k); });
-    }
-  };
-  Kokkos::fence();
-  parallel_for(m_tp_ne_qsize, feq);
+  if ( ! fuse_tracers) {
+    const auto feq = KOKKOS_LAMBDA (const MT& team) {
+      KernelVariables kv(team, qsize, tu_ne_qsize);
+      remap_q(kv, kv.ie, kv.iq);
+    };
+    Kokkos::fence();
+    parallel_for(m_tp_ne_qsize, feq);
+  }
 
   // Halo exchange extrema data.
   m_extrema_be->exchange_min_max();
 
-  const auto geq = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, qsize, tu_ne_qsize);
-    const auto ie = kv.ie, iq = kv.iq;
+  const auto limit_q = KOKKOS_LAMBDA (const KernelVariables& kv, const int ie, const int iq) {
     const auto all = Kokkos::ALL();
     const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
     // Augment bounds with GLL Q0 bounds. This assures that if the tendency is
@@ -777,7 +806,22 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
                          evus_np2_nlev(rw1.data()), fq_ie);
   };
   Kokkos::fence();
-  parallel_for(m_tp_ne_qsize, geq);
+  if (fuse_tracers) {
+    const auto ge = KOKKOS_LAMBDA (const MT& team) {
+      KernelVariables kv(team, tu_ne);
+      for (int iq = 0; iq < qsize; ++iq) {
+        if (iq > 0) kv.team_barrier();
+        limit_q(kv, kv.ie, iq);
+      }
+    };
+    parallel_for(m_tp_ne, ge);
+  } else {
+    const auto geq = KOKKOS_LAMBDA (const MT& team) {
+      KernelVariables kv(team, qsize, tu_ne_qsize);
+      limit_q(kv, kv.ie, kv.iq);
+    };
+    parallel_for(m_tp_ne_qsize, geq);
+  }
 #endif
 }
 
@@ -790,9 +834,7 @@ void GllFvRemapImpl::run_fv_phys_to_dyn_dss () {
   const auto fq = m_tracers.fq;
   const auto fm = m_forcing.m_fm;
   const auto ft = m_forcing.m_ft;
-  const auto f = KOKKOS_LAMBDA (const MT& team) {
-    const int ie  = team.league_rank() / n_dss_fld;
-    const int idx = team.league_rank() % n_dss_fld;
+  const auto scale = KOKKOS_LAMBDA (const MT& team, const int ie, const int idx) {
     const auto ttrg = Kokkos::TeamThreadRange(team, np2);
     const auto tvr  = Kokkos::ThreadVectorRange(team, nlevpk);
     const evucr1 s(&gll_spheremp(ie,0,0), np2);
@@ -803,7 +845,19 @@ void GllFvRemapImpl::run_fv_phys_to_dyn_dss () {
     loop_ik(ttrg, tvr, [&] (int i, int k) { f_ie(i,k) *= s(i); });
   };
   Kokkos::fence();
-  Kokkos::parallel_for(m_tp_ne_dss, f);
+  if (m_data.fuse_tracers) {
+    const auto f = KOKKOS_LAMBDA (const MT& team) {
+      for (int idx = 0; idx < n_dss_fld; ++idx)
+        scale(team, team.league_rank(), idx);
+    };
+    Kokkos::parallel_for(m_tp_ne, f);
+  } else {
+    const auto f = KOKKOS_LAMBDA (const MT& team) {
+      scale(team, team.league_rank() / n_dss_fld, team.league_rank() % n_dss_fld);
+    };
+    Kokkos::parallel_for(m_tp_ne_dss, f);
+  }
+  // All tracers, FM, and FT go in one exchange.
   m_dss_be->exchange(m_geometry.m_rspheremp);
 }
 
@@ -851,8 +905,26 @@ void GllFvRemapImpl
   
   ElementOps ops; ops.init(hvcoord);
 
-  // dp
+  const auto dp_g = m_state.m_dp3d;
+  const auto remap_q = KOKKOS_LAMBDA (const KernelVariables& kv, const int ie, const int iq) {
+    const auto all = Kokkos::ALL();
+    const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
+    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
+
+    const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
+      gll_metdet_ie(&gll_metdet(ie,0,0), np2);
+    const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
+    
+    g2f_mixing_ratio(
+      kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
+      evucs_np2_nlev(&dp_g(ie,timeidx,0,0,0)), dp_fv_ie, evucs_np2_nlev(&q_dyn(ie,iq,0,0)),
+      evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()), iq,
+      evus3(&q_fv(ie,0,0,0), q_fv.extent_int(1), q_fv.extent_int(2), q_fv.extent_int(3)));
+  };
+
+  // dp, and q if fused
   const auto tu_ne = m_tu_ne;
+  const bool fuse_tracers = m_data.fuse_tracers;
   const auto fe = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, tu_ne);
     const auto ie = kv.ie;
@@ -873,31 +945,24 @@ void GllFvRemapImpl
       calc_dp_fv(team, hvcoord, nf2, nlevpk, EVU<Real*>(ps_v_fv_ie.data(), nf2),
                  dp_fv_ie);
     }
+
+    if (fuse_tracers) {
+      for (int iq = 0; iq < nq; ++iq) {
+        kv.team_barrier();
+        remap_q(kv, ie, iq);
+      }
+    }
   };
   Kokkos::fence();
   Kokkos::parallel_for(m_tp_ne, fe);
+  if (fuse_tracers) return;
 
   // q
-  const auto dp_g = m_state.m_dp3d;
   const auto tp_ne_nq = Homme::get_default_team_policy<ExecSpace>(m_data.nelemd * nq);
   const auto tu_ne_nq = TeamUtils<ExecSpace>(tp_ne_nq);
   const auto feq = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, nq, tu_ne_nq);
-    const auto ie = kv.ie, iq = kv.iq;
-
-    const auto all = Kokkos::ALL();
-    const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
-    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
-
-    const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
-      gll_metdet_ie(&gll_metdet(ie,0,0), np2);
-    const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
-    
-    g2f_mixing_ratio(
-      kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
-      evucs_np2_nlev(&dp_g(ie,timeidx,0,0,0)), dp_fv_ie, evucs_np2_nlev(&q_dyn(ie,iq,0,0)),
-      evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()), iq,
-      evus3(&q_fv(ie,0,0,0), q_fv.extent_int(1), q_fv.extent_int(2), q_fv.extent_int(3)));
+    remap_q(kv, kv.ie, kv.iq);
   };
   Kokkos::fence();
   Kokkos::parallel_for(tp_ne_nq, feq);
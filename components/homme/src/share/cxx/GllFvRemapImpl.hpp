@@ -61,6 +61,10 @@ struct GllFvRemapImpl {
   struct Data {
     int nelemd, qsize, nf2, n_dss_fld;
     bool use_moisture, theta_hydrostatic_mode;
+    // If true, each element's team also loops over the tracers, rather than
+    // the tracers getting their own (element, tracer) teams in a separate
+    // kernel.
+    bool fuse_tracers;
 
     static constexpr int nbuf1 = 2, nbuf2 = 1;
     Buf1 buf1[nbuf1];
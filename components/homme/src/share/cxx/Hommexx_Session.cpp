@@ -9,6 +9,7 @@
 #include "ExecSpaceDefs.hpp"
 #include "profiling.hpp"
 #include "mpi/Comm.hpp"
+#include "ThreadsTuner.hpp"
 
 #include "Context.hpp"
 
@@ -97,6 +98,10 @@ void initialize_hommexx_session ()
 void finalize_hommexx_session ()
 {
   if (Session::m_inited) {
+    // Save the team sizes picked by the tuner (if any) for later runs
+    if (Context::singleton().has<ThreadsTuner>()) {
+      Context::singleton().get<ThreadsTuner>().finalize();
+    }
     Context::finalize_singleton();
 
     if (Session::m_handle_kokkos) {
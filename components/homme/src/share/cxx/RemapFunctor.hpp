@@ -10,6 +10,7 @@
 #include <memory>
 #include <type_traits>
 
+#include "Context.hpp"
 #include "ErrorDefs.hpp"
 
 #include "Elements.hpp"
@@ -23,6 +24,7 @@
 #include "utilities/SubviewUtils.hpp"
 #include "utilities/SyncUtils.hpp"
 #include "RemapStateProvider.hpp"
+#include "ThreadsTuner.hpp"
 
 #include "profiling.hpp"
 
@@ -473,8 +475,7 @@ struct RemapFunctor : public Remapper {
       }
       run_functor<ComputeGridsTag>("Remap Compute Grids Functor",
                                    m_state.num_elems());
-      run_functor<ComputeRemapTag>("Remap Compute Remap Functor",
-                                   m_state.num_elems() * num_to_remap());
+      run_remap_functor();
       if (nonzero_rsplit) {
         run_functor<ComputeIntrinsicsTag>("Remap Rescale States Functor",
                                           m_state.num_elems() * m_fields_provider.num_states_remap());
@@ -565,6 +566,28 @@ private:
     return Homme::get_default_team_policy<ExecSpace, FunctorTag>(num_exec, tp);
   }
 
+  // Same as run_functor<ComputeRemapTag>, but the team size is picked by the
+  // tuner. m_tu_ne_ntr must match the policy we launch, and is restored
+  // afterwards since remap1 uses it with the default policy.
+  void run_remap_functor() {
+    auto policy = remap_team_policy<ComputeRemapTag>(m_state.num_elems() * num_to_remap());
+    auto& tuner = Context::singleton().create_if_not_there<ThreadsTuner>();
+    policy = ThreadsTuner::with_team_size(policy,
+        tuner.team_size("remap", policy.league_size(), policy.team_size()));
+    const auto tu_ne_ntr = m_tu_ne_ntr;
+    m_tu_ne_ntr = TeamUtils<ExecSpace>(policy);
+
+    GPTLstart("Remap Compute Remap Functor");
+    profiling_resume();
+    tuner.start("remap");
+    Kokkos::parallel_for("vertical remap", policy, *this);
+    Kokkos::fence();
+    tuner.stop("remap");
+    profiling_pause();
+    GPTLstop("Remap Compute Remap Functor");
+    m_tu_ne_ntr = tu_ne_ntr;
+  }
+
   template <typename FunctorTag>
   void run_functor(const std::string functor_name, int num_exec) {
     const auto policy = remap_team_policy<FunctorTag>(num_exec);
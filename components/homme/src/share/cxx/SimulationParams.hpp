@@ -69,6 +69,22 @@ struct SimulationParams
   // to >0 for diagnostics.
   int       internal_diagnostics_level = 0;
 
+  // Overlap the CAAR boundary exchange with the computation of the elements
+  // that have no neighbor on a remote process. Default is false.
+  bool      caar_overlap_exchange = false;
+
+  // In boundary exchanges, read data from ranks on the same node directly
+  // from their send buffer (via MPI-3 shared memory). CPU builds only.
+  bool      be_use_shared_memory = false;
+
+  // Overlap the hyperviscosity boundary exchanges with the computation of the
+  // elements that have no neighbor on a remote process. Default is false.
+  bool      hv_overlap_exchange = false;
+
+  // Pick the team size of the main kernels by timing them during the first
+  // steps, and cache the choices in a file (see ThreadsTuner). CPU builds only.
+  bool      autotune_threads = false;
+
   // Use this member to check whether the struct has been initialized
   bool      params_set = false;
 };
@@ -113,6 +129,10 @@ inline void SimulationParams::print (std::ostream& out) {
   out << "   dp3d_thresh: " << dp3d_thresh << "\n";
   out << "   vtheta_thresh: " << vtheta_thresh << "\n";
   out << "   internal_diagnostics_level: " << internal_diagnostics_level << "\n";
+  out << "   caar_overlap_exchange: " << (caar_overlap_exchange ? "yes" : "no") << "\n";
+  out << "   be_use_shared_memory: " << (be_use_shared_memory ? "yes" : "no") << "\n";
+  out << "   hv_overlap_exchange: " << (hv_overlap_exchange ? "yes" : "no") << "\n";
+  out << "   autotune_threads: " << (autotune_threads ? "yes" : "no") << "\n";
   out << "\n**********************************************************\n";
 }
 
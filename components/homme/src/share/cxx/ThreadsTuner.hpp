@@ -0,0 +1,343 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#ifndef HOMMEXX_THREADS_TUNER_HPP
+#define HOMMEXX_THREADS_TUNER_HPP
+
+#include "ExecSpaceDefs.hpp"
+#include "mpi/Comm.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+#include <unistd.h>
+
+namespace Homme
+{
+
+/*
+ * Pick the team size of the main kernels by timing them, rather than relying
+ * on the static heuristic of DefaultThreadsDistribution. CPU only: on GPU the
+ * tuner always returns the default team size.
+ *
+ * A kernel (or group of kernels sharing one TeamUtils) is identified by a
+ * name. Each call to team_size(name,...) starts a new sample, which lasts
+ * until the next call with the same name; the time between the start(name)
+ * and stop(name) calls of the sample is attributed to the team size that was
+ * returned. The candidates are cycled num_trials times, and then the fastest
+ * (min over trials) is kept for the rest of the run.
+ *
+ * The choice is collective: the time of each candidate is the max over the
+ * ranks (a step is as fast as its slowest rank), root picks the fastest, and
+ * broadcasts it, so that all ranks use the same team size. Hence, all ranks
+ * must call team_size(name,...) the same number of times.
+ *
+ *   auto& tuner = Context::singleton().create_if_not_there<ThreadsTuner>();
+ *   const int ts = tuner.team_size("caar", league_size, policy.team_size());
+ *   policy = ThreadsTuner::with_team_size(policy, ts);
+ *   m_tu = TeamUtils<ExecSpace>(policy);
+ *   tuner.start("caar");
+ *   Kokkos::parallel_for(policy, *this);
+ *   tuner.stop("caar");
+ *
+ * Candidates are the default team size and the divisors of the thread pool
+ * that are larger than it. The workspace of a functor is sized with the TeamUtils
+ * of its default policy, so a smaller team size would hand out more slots
+ * than were allocated. Vector lengths are not tuned: on host execution spaces
+ * a ThreadVectorRange is a serial loop, whatever the vector length.
+ *
+ * The choices are stored in a text file, one per line,
+ *   machine name pool_size league_size team_size
+ * where machine is the host name with the trailing node number stripped, so
+ * that all nodes of a cluster share the entries. On later runs, a kernel with
+ * an entry for the same machine and pool size, and a league size within a
+ * factor 2, uses the cached team size and is not tuned again. Root reads the
+ * file and broadcasts its content when the tuner is enabled, and writes it
+ * back, once, in finalize(), if new choices were made.
+ */
+class ThreadsTuner {
+public:
+
+  ThreadsTuner ()
+   : m_enabled(false)
+   , m_root(false)
+   , m_cache_modified(false)
+   , m_num_trials(0)
+   , m_pool_size(1)
+   , m_mpi_comm(MPI_COMM_NULL)
+  {}
+
+  // Collective on comm. The pool size defaults to the concurrency of ExecSpace.
+  void enable (const Comm& comm, const std::string& cache_file,
+               const int num_trials = 3, const int pool_size = -1) {
+    if (OnGpu<ExecSpace>::value) {
+      return;
+    }
+    m_enabled = true;
+    m_mpi_comm = comm.mpi_comm();
+    m_root = comm.root();
+    m_cache_file = cache_file;
+    m_num_trials = num_trials;
+    m_pool_size = pool_size>0 ? pool_size : ExecSpace().concurrency();
+    m_machine = get_machine_name();
+    read_cache();
+  }
+
+  // Write the new choices, if any, to the cache file. Only root writes.
+  void finalize () {
+    if (m_enabled && m_root && m_cache_modified) {
+      write_cache();
+    }
+    m_cache_modified = false;
+  }
+
+  bool enabled () const { return m_enabled; }
+
+  // The team size to use for the next run of the kernel(s) 'name'. Collective
+  // while the kernel is being tuned, or when its league size changes (which
+  // must then happen on all ranks at the same call).
+  int team_size (const std::string& name, const int league_size,
+                 const int default_team_size) {
+    if (!m_enabled) {
+      return default_team_size;
+    }
+
+    auto& k = m_kernels[name];
+    if (k.league_size!=league_size) {
+      k = Kernel();
+      init_kernel(name,league_size,default_team_size,k);
+    }
+
+    if (k.best>=0) {
+      return k.best;
+    }
+
+    // Close the previous sample, if any, and move to the next candidate. The
+    // sample count must not depend on the timings, since it is used to decide
+    // when all ranks enter the reduction below.
+    const int ncand = k.candidates.size();
+    if (k.sample>=0) {
+      if (k.elapsed>0) {
+        auto& t = k.times[k.sample % ncand];
+        t = std::min(t,k.elapsed);
+      }
+      ++k.sample;
+    } else {
+      k.sample = 0;
+    }
+    k.elapsed = 0;
+
+    if (k.sample==ncand*m_num_trials) {
+      k.best = pick_best(k);
+      if (m_root) {
+        std::cout << "ThreadsTuner: " << name << " (league size " << k.global_league_size
+                  << "): team size " << k.best << " (default " << k.candidates[0] << ")\n";
+      }
+      m_cache[cache_key(name,m_pool_size)][k.global_league_size] = k.best;
+      m_cache_modified = true;
+      return k.best;
+    }
+
+    return k.candidates[k.sample % ncand];
+  }
+
+  void start (const std::string& name) {
+    auto it = m_kernels.find(name);
+    if (it==m_kernels.end() || it->second.best>=0) {
+      return;
+    }
+    Kokkos::fence();
+    it->second.start = std::chrono::steady_clock::now();
+  }
+
+  void stop (const std::string& name) {
+    auto it = m_kernels.find(name);
+    if (it==m_kernels.end() || it->second.best>=0) {
+      return;
+    }
+    Kokkos::fence();
+    const std::chrono::duration<double> dt = std::chrono::steady_clock::now() - it->second.start;
+    it->second.elapsed += dt.count();
+  }
+
+  // A copy of the policy with a different team size
+  template<typename... Props>
+  static Kokkos::TeamPolicy<Props...>
+  with_team_size (const Kokkos::TeamPolicy<Props...>& policy, const int team_size) {
+    if (team_size==policy.team_size()) {
+      return policy;
+    }
+    Kokkos::TeamPolicy<Props...> p(policy.league_size(),team_size,policy.impl_vector_length());
+    p.set_chunk_size(policy.chunk_size());
+    return p;
+  }
+
+private:
+
+  struct Kernel {
+    Kernel () : league_size(-1), global_league_size(0), best(-1), sample(-1), elapsed(0) {}
+
+    int league_size;
+    int global_league_size;
+    int best;
+    std::vector<int>  candidates;
+    std::vector<double> times;
+
+    int sample;
+    double elapsed;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  // Collective: candidates and cache lookups use the max over the ranks of the
+  // league size and default team size, so that all ranks agree on them. A team
+  // size valid for the largest default is valid for all ranks.
+  void init_kernel (const std::string& name, const int league_size,
+                    const int local_default_team_size, Kernel& k) const {
+    k.league_size = league_size;
+
+    int sizes[2] = {league_size, local_default_team_size};
+    MPI_Allreduce(MPI_IN_PLACE,sizes,2,MPI_INT,MPI_MAX,m_mpi_comm);
+    k.global_league_size = std::max(sizes[0],1);
+    const int default_team_size = sizes[1];
+
+    // Look for a cached choice with a similar league size
+    const auto cached = m_cache.find(cache_key(name,m_pool_size));
+    if (cached!=m_cache.end()) {
+      double best_ratio = std::log(2.0);
+      for (const auto& e : cached->second) {
+        const double ratio = std::abs(std::log(double(e.first)/k.global_league_size));
+        if (ratio<=best_ratio && valid(e.second,default_team_size)) {
+          best_ratio = ratio;
+          k.best = e.second;
+        }
+      }
+      if (k.best>=0) {
+        return;
+      }
+    }
+
+    k.candidates.push_back(default_team_size);
+    for (int ts=default_team_size+1; ts<=m_pool_size; ++ts) {
+      if (valid(ts,default_team_size)) {
+        k.candidates.push_back(ts);
+      }
+    }
+    if (k.candidates.size()<=1) {
+      k.best = default_team_size;
+    }
+    k.times.resize(k.candidates.size(),std::numeric_limits<double>::max());
+  }
+
+  // The candidate with the smallest max-over-ranks time, picked on root and
+  // broadcast to all ranks.
+  int pick_best (const Kernel& k) const {
+    std::vector<double> times(k.times.size());
+    MPI_Reduce(k.times.data(),times.data(),times.size(),MPI_DOUBLE,MPI_MAX,0,m_mpi_comm);
+    int best = k.candidates[0];
+    if (m_root) {
+      int ibest = 0;
+      for (int i=1; i<static_cast<int>(times.size()); ++i) {
+        if (times[i]<times[ibest]) {
+          ibest = i;
+        }
+      }
+      best = k.candidates[ibest];
+    }
+    MPI_Bcast(&best,1,MPI_INT,0,m_mpi_comm);
+    return best;
+  }
+
+  bool valid (const int ts, const int default_team_size) const {
+    return ts>=default_team_size && ts<=m_pool_size && m_pool_size%ts==0;
+  }
+
+  std::string cache_key (const std::string& name, const int pool_size) const {
+    std::stringstream ss;
+    ss << m_machine << " " << name << " " << pool_size;
+    return ss.str();
+  }
+
+  static std::string get_machine_name () {
+    char buf[256];
+    if (gethostname(buf,sizeof(buf))!=0) {
+      return "unknown";
+    }
+    buf[sizeof(buf)-1] = '\0';
+    std::string host(buf);
+    host = host.substr(0,host.find('.'));
+    const auto last = host.find_last_not_of("0123456789");
+    if (last!=std::string::npos) {
+      host = host.substr(0,last+1);
+    }
+    return host.empty() ? "unknown" : host;
+  }
+
+  // Root reads the file, and broadcasts its content to the other ranks
+  void read_cache () {
+    std::string content;
+    if (m_root) {
+      std::ifstream f(m_cache_file);
+      std::stringstream ss;
+      ss << f.rdbuf();
+      content = ss.str();
+    }
+    int size = content.size();
+    MPI_Bcast(&size,1,MPI_INT,0,m_mpi_comm);
+    content.resize(size);
+    if (size>0) {
+      MPI_Bcast(&content[0],size,MPI_CHAR,0,m_mpi_comm);
+    }
+
+    std::stringstream f(content);
+    std::string line;
+    while (std::getline(f,line)) {
+      std::stringstream ss(line);
+      std::string machine, name;
+      int pool_size, league_size, ts;
+      if (ss >> machine >> name >> pool_size >> league_size >> ts) {
+        std::stringstream key;
+        key << machine << " " << name << " " << pool_size;
+        m_cache[key.str()][league_size] = ts;
+      }
+    }
+  }
+
+  void write_cache () const {
+    std::ofstream f(m_cache_file);
+    for (const auto& k : m_cache) {
+      for (const auto& e : k.second) {
+        f << k.first << " " << e.first << " " << e.second << "\n";
+      }
+    }
+  }
+
+  bool        m_enabled;
+  bool        m_root;
+  bool        m_cache_modified;
+  int         m_num_trials;
+  int         m_pool_size;
+  MPI_Comm    m_mpi_comm;
+  std::string m_cache_file;
+  std::string m_machine;
+
+  // "machine name pool_size" -> (league size -> team size)
+  std::map<std::string,std::map<int,int>> m_cache;
+  std::map<std::string,Kernel>            m_kernels;
+};
+
+} // namespace Homme
+
+#endif // HOMMEXX_THREADS_TUNER_HPP
@@ -151,9 +151,6 @@ void BoundaryExchange::set_num_fields (const int num_1d_fields, const int num_2d
   // store a valid number of elements, but may be finalized later (before registration_completed call though)
   assert (m_connectivity && m_connectivity->is_initialized());
 
-  // We strongly advocate for not using the same BE object for both 'standard' exchange and min/max exchange
-  assert (!(num_1d_fields>0 && (num_2d_fields>0 || num_3d_fields>0 || num_3d_int_fields>0)));
-
   // Note: we do not set m_num_1d_fields, m_num_2d_fields and m_num_3d_fields, since we will use them as
   //       progressive indices while adding fields. Then, during registration_completed,
   //       we will check that they match the 2nd dimension of m_1d_fields, m_2d_fields and m_3d_fields.
@@ -233,8 +230,10 @@ void BoundaryExchange::registration_completed()
   m_elem_buf_size[etoi(ConnectionKind::CORNER)] = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * 1;
   m_elem_buf_size[etoi(ConnectionKind::EDGE)]   = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * NP;
 
-  // Determine what kind of BE is this (exchange or exchange_min_max)
-  m_exchange_type = m_num_1d_fields>0 ? MPI_EXCHANGE_MIN_MAX : MPI_EXCHANGE;
+  // Determine what kind of BE is this (exchange or exchange_min_max). A BE with both
+  // 1d and 2d/3d fields is a batched exchange, which uses exchange.
+  const bool has_accumulated_fields = m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields>0;
+  m_exchange_type = m_num_1d_fields>0 && !has_accumulated_fields ? MPI_EXCHANGE_MIN_MAX : MPI_EXCHANGE;
 
   // Finalize bookkeeping for any exchange on fewer than NUM_LEV levels.
   {
@@ -360,12 +359,23 @@ void BoundaryExchange::exchange_min_max ()
 #endif
 }
 
+// Packing the connections shared with remote processes separately from the
+// others allows to post the MPI sends before all elements are ready
+// (see pack_and_send_shared and pack_local).
+enum PackConnections : int { PACK_ALL = 0, PACK_SHARED = 1, PACK_NON_SHARED = 2 };
+
+KOKKOS_INLINE_FUNCTION
+static bool do_pack (const int which, const std::uint8_t sharing) {
+  return which==PACK_ALL ||
+         (which==PACK_SHARED) == (sharing==etoi(ConnectionSharing::SHARED));
+}
+
 static void
 pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> send_2d_buffers,
-      const int num_elems, const int num_2d_fields) {
+      const int num_elems, const int num_2d_fields, const int which) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
   const int nconn = ucon.extent_int(0);
   Kokkos::parallel_for(
@@ -374,6 +384,8 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const int iconn = it / num_2d_fields;
       const int ifield = it % num_2d_fields;
       const auto& info = ucon(iconn);
+      if (!do_pack(which, info.sharing))
+        return;
       const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                 info.sharing_local_remote_iconn :
                                 iconn);
@@ -391,7 +403,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
-      const int num_elems, const int num_3d_fields,
+      const int num_elems, const int num_3d_fields, const int which,
       ExecViewManaged<int*>* nlev_packs_ = nullptr) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
@@ -411,6 +423,8 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         }
         const int iconn = it / (num_3d_fields*NUM_LEV_PACKS);
         const auto& info = ucon(iconn);
+        if (!do_pack(which, info.sharing))
+          return;
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
                                   iconn);
@@ -442,6 +456,8 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         for (int iconn = ucon_ptr(ie); iconn < iconn_end; ++iconn) {
           const auto& info = ucon(iconn);
           assert(info.kind != etoi(ConnectionSharing::MISSING));
+          if (!do_pack(which, info.sharing))
+            continue;
           const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                     info.sharing_local_remote_iconn :
                                     iconn);
@@ -490,39 +506,146 @@ void BoundaryExchange::pack_and_send ()
   }
 
   // ---- Pack ---- //
+  pack(PACK_ALL);
+
+  // ---- Send ---- //
+  send();
+  tstop("be pack_and_send");
+}
+
+void BoundaryExchange::pack_and_send_shared ()
+{
+  // The registration MUST be completed by now
+  // Note: this also implies connectivity and buffers manager are valid
+  assert (m_registration_completed);
+
+  // Check that this object is setup to perform exchange and not exchange_min_max
+  assert (m_exchange_type==MPI_EXCHANGE);
+
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  tstart("be pack_and_send_shared");
+  // Check that buffers are not locked by someone else, then lock them
+  assert (!m_buffers_manager->are_buffers_busy());
+  m_buffers_manager->lock_buffers();
+
+  if (!m_buffer_views_and_requests_built) {
+    tstart("be build_buffer_views_and_requests");
+    build_buffer_views_and_requests();
+    tstop("be build_buffer_views_and_requests");
+  }
+
+  // Neighbors may start sending while we are still packing (or computing)
+  if ( ! m_recv_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+  m_recv_pending = true;
+
+  // ---- Pack (remote connections only) ---- //
+  pack(PACK_SHARED);
+
+  // ---- Send ---- //
+  send();
+  tstop("be pack_and_send_shared");
+}
+
+void BoundaryExchange::pack_local ()
+{
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  // Must be called after pack_and_send_shared and before recv_and_unpack
+  assert (m_send_pending);
+
+  tstart("be pack_local");
+  pack(PACK_NON_SHARED);
+  tstop("be pack_local");
+}
+
+// Min/max pack/unpack (defined below), also used by batched exchanges
+static void pack_min_max (
+  const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
+  const ExecViewUnmanaged<const int*> ucon_ptr,
+  const ExecViewUnmanaged<ExecViewManaged<Scalar[2][NUM_LEV]>**> fields_1d,
+  const ExecViewUnmanaged<ExecViewUnmanaged<Scalar[2][NUM_LEV]>**> send_1d_buffers,
+  const int num_elems, const int num_1d_fields, const int which);
+static void unpack_min_max (
+  const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
+  const ExecViewUnmanaged<const int*> ucon_ptr,
+  const ExecViewUnmanaged<ExecViewManaged<Scalar[2][NUM_LEV]>**> fields_1d,
+  const ExecViewUnmanaged<ExecViewUnmanaged<Scalar[2][NUM_LEV]>**> recv_1d_buffers,
+  const int num_elems, const int num_1d_fields);
+
+void BoundaryExchange::pack (const int which)
+{
   const auto& ucon = m_connectivity->get_d_ucon();
   const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
-  // First, pack 2d fields (if any)...
+  // Batched exchange: pack the min/max fields (if any)...
+  if (m_num_1d_fields > 0)
+    pack_min_max(ucon, ucon_ptr, m_1d_fields, m_send_1d_buffers, m_num_elems,
+                 m_num_1d_fields, which);
+  // ...then pack 2d fields (if any)...
   if (m_num_2d_fields > 0)
-    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
-         m_num_2d_fields);
+    Homme::pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
+                m_num_2d_fields, which);
   // ...then pack 3d fields (if any)...
   if (m_num_3d_fields > 0) {
     if (m_3d_nlev_pack_d.size() > 0)
-      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
+      Homme::pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                                 m_num_elems, m_num_3d_fields, which, &m_3d_nlev_pack_d);
     else
-      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                    m_num_elems, m_num_3d_fields);
+      Homme::pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                           m_num_elems, m_num_3d_fields, which);
   }
   // ...then pack 3d interface fields (if any)
   if (m_num_3d_int_fields > 0)
-    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
-                    m_num_elems, m_num_3d_int_fields);
+    Homme::pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
+                           m_num_elems, m_num_3d_int_fields, which);
   Kokkos::fence();
+}
 
-  // ---- Send ---- //
+void BoundaryExchange::send ()
+{
   tstart("be sync_send_buffer");
   m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
   tstop("be sync_send_buffer");
   tstart("be send");
+  start_sends();
+  tstop("be send");
+
+  // Notify a send is ongoing
+  m_send_pending = true;
+}
+
+void BoundaryExchange::start_sends ()
+{
+  // Make the packed data visible to on-node neighbors before notifying them
+  m_buffers_manager->sync_shared_memory();
+
   if ( ! m_send_requests.empty())
     HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
                             m_connectivity->get_comm().mpi_comm());
+  if ( ! m_shm_ack_recv_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_shm_ack_recv_requests.size(), m_shm_ack_recv_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+}
 
-  // Notify a send is ongoing
-  m_send_pending = true;
-  tstop("be pack_and_send");
+void BoundaryExchange::complete_shm_acks ()
+{
+  if (m_shm_ack_send_requests.empty()) {
+    return;
+  }
+
+  const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_shm_ack_send_requests.size(), m_shm_ack_send_requests.data()),
+                          mpi_comm);
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_shm_ack_recv_requests.size(), m_shm_ack_recv_requests.data(),
+                                      MPI_STATUSES_IGNORE), mpi_comm);
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_shm_ack_send_requests.size(), m_shm_ack_send_requests.data(),
+                                      MPI_STATUSES_IGNORE), mpi_comm);
 }
 
 void BoundaryExchange::recv_and_unpack () {
@@ -717,6 +840,7 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
   tstop("be recv waitall");
 
   tstart("be recv_and_unpack book");
+  m_buffers_manager->sync_shared_memory();
   m_buffers_manager->sync_recv_buffer(this);
 
   tstop("be recv_and_unpack book");
@@ -724,7 +848,11 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
   // --- Unpack --- //
   const auto& ucon = m_connectivity->get_d_ucon();
   const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
-  // First, unpack 2d fields (if any)...
+  // Batched exchange: min/max the 1d fields (if any)...
+  if (m_num_1d_fields>0)
+    unpack_min_max(ucon, ucon_ptr, m_1d_fields, m_recv_1d_buffers, m_num_elems,
+                   m_num_1d_fields);
+  // ...then unpack 2d fields (if any)...
   if (m_num_2d_fields>0)
     unpack(ucon, ucon_ptr, m_2d_fields, m_recv_2d_buffers, rspheremp, m_num_elems,
            m_num_2d_fields);
@@ -748,6 +876,11 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
   // buffers. Therefore, we must ensure that, upon return, all buffers are
   // reusable.
 
+  // We are done reading from on-node neighbors send buffers
+  tstart("be shm acks");
+  complete_shm_acks();
+  tstop("be shm acks");
+
   tstart("be waitall 2");
   if ( ! m_send_requests.empty())
     HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_send_requests.size(), m_send_requests.data(),
@@ -769,7 +902,7 @@ static void pack_min_max (
   const ExecViewUnmanaged<const int*> ucon_ptr,
   const ExecViewUnmanaged<ExecViewManaged<Scalar[2][NUM_LEV]>**> fields_1d,
   const ExecViewUnmanaged<ExecViewUnmanaged<Scalar[2][NUM_LEV]>**> send_1d_buffers,
-  const int num_elems, const int num_1d_fields)
+  const int num_elems, const int num_1d_fields, const int which)
 {
   if (OnGpu<ExecSpace>::value) {
     const ConnectionHelpers helpers;
@@ -781,6 +914,8 @@ static void pack_min_max (
         const int ifield = (it / NUM_LEV) % num_1d_fields;
         const int ilev = it % NUM_LEV;
         const auto& info = ucon(iconn);
+        if (!do_pack(which, info.sharing))
+          return;
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
                                   iconn);
@@ -811,6 +946,8 @@ static void pack_min_max (
         for (int iconn = ucon_ptr(ie); iconn < iconn_end; ++iconn) {
           const auto& info = ucon(iconn);
           assert(info.kind != etoi(ConnectionSharing::MISSING));
+          if (!do_pack(which, info.sharing))
+            continue;
           const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                     info.sharing_local_remote_iconn :
                                     iconn);
@@ -858,14 +995,12 @@ void BoundaryExchange::pack_and_send_min_max ()
   }
 
   pack_min_max(m_connectivity->get_d_ucon(), m_connectivity->get_d_ucon_ptr(),
-               m_1d_fields, m_send_1d_buffers, m_num_elems, m_num_1d_fields);
+               m_1d_fields, m_send_1d_buffers, m_num_elems, m_num_1d_fields, PACK_ALL);
   Kokkos::fence();
 
   // ---- Send ---- //
   m_buffers_manager->sync_send_buffer(this);
-  if ( ! m_send_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
-                            m_connectivity->get_comm().mpi_comm());
+  start_sends();
 
   // Mark send buffer as busy
   m_send_pending = true;
@@ -969,12 +1104,16 @@ void BoundaryExchange::recv_and_unpack_min_max ()
     HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
                             m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
 
+  m_buffers_manager->sync_shared_memory();
   m_buffers_manager->sync_recv_buffer(this); // Deep copy mpi_recv_buffer into recv_buffer (no op if MPI is on device)
 
   unpack_min_max(m_connectivity->get_d_ucon(), m_connectivity->get_d_ucon_ptr(),
                  m_1d_fields, m_recv_1d_buffers, m_num_elems, m_num_1d_fields);
   Kokkos::fence();
 
+  // We are done reading from on-node neighbors send buffers
+  complete_shm_acks();
+
   // If another BE structure starts an exchange, it has no way to check that
   // this object has finished its send requests, and may erroneously reuse the
   // buffers. Therefore, we must ensure that, upon return, all buffers are
@@ -1070,14 +1209,64 @@ void BoundaryExchange::build_buffer_views_and_requests()
   const auto h_send_3d_int_buffers = Kokkos::create_mirror_view(m_send_3d_int_buffers);
   const auto h_recv_3d_int_buffers = Kokkos::create_mirror_view(m_recv_3d_int_buffers);
 
+  // Offset of each pid block in the mpi buffers
+  const int npids = pids.size();
+  std::vector<int> pid_buf_offsets(npids+1,0);
+  for (int ip = 0; ip < npids; ++ip) {
+    int count = 0;
+    for (int k = pid_offsets[ip]; k < pid_offsets[ip+1]; ++k) {
+      count += m_elem_buf_size[ucon(slot_idx_to_elem_conn_pair[k]).kind];
+    }
+    pid_buf_offsets[ip+1] = pid_buf_offsets[ip] + count;
+  }
+
+  // With shared memory, data from on-node pids is read directly from their send
+  // buffer. Both sides agree on the layout of a pid block, so we only need the
+  // offset of our block in their send buffer, and we shift the recv pointer
+  // so that (shifted ptr + our offset) points to the right place.
+  std::vector<local_buf_ptr_type> shm_recv_base(npids,nullptr);
+  const bool use_shm = buffers_manager->uses_shared_memory();
+  if (use_shm) {
+    const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
+    std::vector<int> remote_offsets(npids,-1);
+    std::vector<MPI_Request> reqs;
+    for (int ip = 0; ip < npids; ++ip) {
+      if (buffers_manager->get_node_rank(pids[ip])==MPI_UNDEFINED)
+        continue;
+      reqs.emplace_back();
+      HOMMEXX_MPI_CHECK_ERROR(MPI_Irecv(&remote_offsets[ip], 1, MPI_INT, pids[ip],
+                                        m_exchange_type+2, mpi_comm, &reqs.back()),
+                              mpi_comm);
+      reqs.emplace_back();
+      HOMMEXX_MPI_CHECK_ERROR(MPI_Isend(&pid_buf_offsets[ip], 1, MPI_INT, pids[ip],
+                                        m_exchange_type+2, mpi_comm, &reqs.back()),
+                              mpi_comm);
+    }
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(reqs.size(), reqs.data(), MPI_STATUSES_IGNORE),
+                            mpi_comm);
+    for (int ip = 0; ip < npids; ++ip) {
+      if (remote_offsets[ip] < 0)
+        continue;
+      const auto remote_buf = buffers_manager->get_node_send_buffer(buffers_manager->get_node_rank(pids[ip]));
+      shm_recv_base[ip] = remote_buf + remote_offsets[ip] - pid_buf_offsets[ip];
+    }
+  }
+
   ConnectionHelpers helpers;
+  int ip = -1;
   for (size_t k = 0; k < nconn; ++k) {
     // Map from MPI buffer index space to (elem, connection) index space.
     const auto i = slot_idx_to_elem_conn_pair[k];
     const auto& info = ucon(i);
 
+    // Keep track of the pid block we are in (local slots come first)
+    if (ip+1 < npids && static_cast<int>(k) == pid_offsets[ip+1])
+      ++ip;
+
     auto& send_buffer = h_all_send_buffers[info.sharing];
-    auto& recv_buffer = h_all_recv_buffers[info.sharing];
+    auto recv_buffer = h_all_recv_buffers[info.sharing];
+    if (info.sharing == etoi(ConnectionSharing::SHARED) && shm_recv_base[ip] != nullptr)
+      recv_buffer = shm_recv_base[ip];
 
     for (int f = 0; f < m_num_1d_fields; ++f) {
       h_send_1d_buffers(f, i) = ExecViewUnmanaged<Scalar[2][NUM_LEV]>(
@@ -1144,19 +1333,27 @@ void BoundaryExchange::build_buffer_views_and_requests()
 
   {
     const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
-    const size_t npids = pids.size();
     free_requests();
     m_send_requests.resize(npids);
     m_recv_requests.resize(npids);
     MPIViewManaged<Real*>::pointer_type send_ptr = buffers_manager->get_mpi_send_buffer().data();
     MPIViewManaged<Real*>::pointer_type recv_ptr = buffers_manager->get_mpi_recv_buffer().data();
-    int offset = 0;
-    for (size_t ip = 0; ip < npids; ++ip) {
-      int count = 0;
-      for (int k = pid_offsets[ip]; k < pid_offsets[ip+1]; ++k) {
-        const auto i = slot_idx_to_elem_conn_pair[k];
-        const auto& info = ucon(i);
-        count += m_elem_buf_size[info.kind];
+    for (int ip = 0; ip < npids; ++ip) {
+      const int offset = pid_buf_offsets[ip];
+      int count = pid_buf_offsets[ip+1] - offset;
+      if (shm_recv_base[ip] != nullptr) {
+        // On-node pid: the message only signals that the data is ready
+        count = 0;
+        m_shm_ack_send_requests.emplace_back();
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Send_init(nullptr, 0, MPI_DOUBLE,
+                                              pids[ip], m_exchange_type+1, mpi_comm,
+                                              &m_shm_ack_send_requests.back()),
+                                m_connectivity->get_comm().mpi_comm());
+        m_shm_ack_recv_requests.emplace_back();
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Recv_init(nullptr, 0, MPI_DOUBLE,
+                                              pids[ip], m_exchange_type+1, mpi_comm,
+                                              &m_shm_ack_recv_requests.back()),
+                                m_connectivity->get_comm().mpi_comm());
       }
       HOMMEXX_MPI_CHECK_ERROR(MPI_Send_init(send_ptr + offset, count, MPI_DOUBLE,
                                             pids[ip], m_exchange_type, mpi_comm,
@@ -1166,7 +1363,6 @@ void BoundaryExchange::build_buffer_views_and_requests()
                                             pids[ip], m_exchange_type, mpi_comm,
                                             &m_recv_requests[ip]),
                               m_connectivity->get_comm().mpi_comm());
-      offset += count;
     }
   }
 
@@ -1184,6 +1380,14 @@ void BoundaryExchange
     HOMMEXX_MPI_CHECK_ERROR(MPI_Request_free(&m_recv_requests[i]),
                             m_connectivity->get_comm().mpi_comm());
   m_recv_requests.clear();
+  for (size_t i=0; i<m_shm_ack_send_requests.size(); ++i)
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Request_free(&m_shm_ack_send_requests[i]),
+                            m_connectivity->get_comm().mpi_comm());
+  m_shm_ack_send_requests.clear();
+  for (size_t i=0; i<m_shm_ack_recv_requests.size(); ++i)
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Request_free(&m_shm_ack_recv_requests[i]),
+                            m_connectivity->get_comm().mpi_comm());
+  m_shm_ack_recv_requests.clear();
 }
 
 // A slot is the space in a communication buffer for an (element, connection)
@@ -1298,6 +1502,8 @@ void BoundaryExchange::waitall()
   if ( ! m_recv_requests.empty())
     HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
                             m_connectivity->get_comm().mpi_comm());
+  if (m_send_pending)
+    complete_shm_acks();
 
   m_buffers_manager->unlock_buffers();
 }
@@ -57,10 +57,13 @@ class MpiBuffersManager;
  *    be buggy, so you are probably better off calling set_num_fields with
  *    the actual number of fields you are going to register. Note that you
  *    are not allowed to call register_field(...) before set_num_fields.
- *    NOTE: you are NOT allowed to register 1d fields together with
- *          2d/3d fields. The idea is that 1d fields are exchanged only as
- *          min/max quantities (so they are not accumulated). Please, use
- *          two different BE objects for accumulation and for min/max.
+ *    NOTE: 1d fields are exchanged only as min/max quantities (so they are
+ *          not accumulated). If 1d fields are registered together with
+ *          2d/3d fields, the BE is a 'batched' exchange: exchange() (or
+ *          pack_and_send/recv_and_unpack) accumulates the 2d/3d fields and
+ *          performs the min/max on the 1d fields, sending a single message
+ *          per neighbor for both. The rspheremp scaling (if any) is only
+ *          applied to the 2d/3d fields.
  *  - a call to registration_completed, which ends the registration phase,
  *    and sets up all the internal structure to prepare for calls to
  *    exchange(). This method MUST be called BEFORE any call to exchange.
@@ -77,6 +80,13 @@ class MpiBuffersManager;
  * automatically removes the 'this' object from the stored BM's customers list
  * (assuming there is a stored BM, otherwise nothing happens).
  *
+ * If the BM uses shared memory (see MpiBuffersManager.hpp), the recv buffer
+ * views for connections with ranks on the same node point directly into the
+ * send buffer of the neighbor, so that no data is copied for those. The MPI
+ * messages to/from on-node ranks are empty, and only signal that the data
+ * is ready. An additional empty message is sent back once the data has been
+ * unpacked, so that the neighbor knows it can overwrite its send buffer.
+ *
  * In order to work correctly, BE needs a valid Connectivity and a valid
  * BM (both stored as shared_ptr). They can be set at construction time
  * or later, via a setter method. There are only a few rules:
@@ -188,11 +198,12 @@ public:
   // Size the buffers, and initialize the MPI types
   void registration_completed();
 
-  // Exchange all registered 2d and 3d fields
+  // Exchange all registered 2d and 3d fields (and 1d min/max fields, for batched BE objects)
   void exchange ();
   void exchange (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
 
-  // Exchange all registered 1d fields, performing min/max operations with neighbors
+  // Exchange all registered 1d fields, performing min/max operations with neighbors.
+  // Only for BE objects with 1d fields only (use exchange for batched BE objects).
   void exchange_min_max ();
 
   // Get the number of 2d/3d fields that this object handles
@@ -219,6 +230,14 @@ public:
   void pack_and_send ();
   void recv_and_unpack ();
 
+  // Split version of pack_and_send, to overlap MPI messages with computations.
+  // pack_and_send_shared packs and sends only the connections with elements on
+  // remote processes, so only the fields on elements having such connections
+  // need to be up to date; pack_local packs the remaining connections. Both must
+  // be called (in this order) before recv_and_unpack.
+  void pack_and_send_shared ();
+  void pack_local ();
+
   // Perform the pack_and_send and recv_and_unpack for min/max boundary exchange of 1d fields
   void pack_and_send_min_max ();
   void recv_and_unpack_min_max ();
@@ -244,6 +263,10 @@ private:
 
   void build_buffer_views_and_requests ();
 
+  // Pack a subset of the connections (see PackConnections in the cpp file), and start the sends
+  void pack (const int which);
+  void send ();
+
   std::shared_ptr<Connectivity>   m_connectivity;
 
   int                       m_elem_buf_size[2];
@@ -251,6 +274,11 @@ private:
   std::vector<MPI_Request>  m_send_requests;
   std::vector<MPI_Request>  m_recv_requests;
 
+  // Shared memory only: signal to on-node neighbors that we are done reading
+  // their send buffer (and receive the same signal from them).
+  std::vector<MPI_Request>  m_shm_ack_send_requests;
+  std::vector<MPI_Request>  m_shm_ack_recv_requests;
+
   ExecViewManaged<ExecViewManaged<Scalar[2][NUM_LEV]>**>            m_1d_fields;
   ExecViewManaged<ExecViewManaged<Real[NP][NP]>**>                  m_2d_fields;
   ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV]>**>       m_3d_fields;
@@ -311,6 +339,10 @@ private:
     std::vector<int>& h_slot_idx_to_elem_conn_pair,
     std::vector<int>& pids, std::vector<int>& pids_os);
   void free_requests();
+  // Start the sends, and the recv of the shared memory acks
+  void start_sends ();
+  // Tell on-node neighbors we are done reading their data, and wait for them to do the same
+  void complete_shm_acks ();
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 public: // This is semantically private but must be public for nvcc.
@@ -329,7 +361,6 @@ void BoundaryExchange::register_field (ExecView<Real*[NP][NP], Properties...> fi
   // Sanity checks
   assert (m_registration_started && !m_registration_completed);
   assert (m_num_2d_fields+1<=m_2d_fields.extent_int(1));
-  assert (m_num_1d_fields==0);
 
   {
     auto l_num_2d_fields = m_num_2d_fields;
@@ -353,7 +384,6 @@ void BoundaryExchange::register_field (ExecView<Real*[DIM][NP][NP], Properties..
   assert (num_dims>0 && start_dim>=0 && DIM>0);
   assert (start_dim+num_dims<=DIM);
   assert (m_num_2d_fields+num_dims<=m_2d_fields.extent_int(1));
-  assert (m_num_1d_fields==0);
 
   {
     auto l_num_2d_fields = m_num_2d_fields;
@@ -377,7 +407,6 @@ void BoundaryExchange::register_field (ExecView<Real**[NP][NP], Properties...> f
   assert (num_dims>0 && start_dim>=0);
   assert (start_dim+num_dims<=field.extent_int(1));
   assert (m_num_2d_fields+num_dims<=m_2d_fields.extent_int(1));
-  assert (m_num_1d_fields==0);
 
   {
     auto l_num_2d_fields = m_num_2d_fields;
@@ -402,7 +431,6 @@ void BoundaryExchange::register_field (ExecView<Real***[NP][NP], Properties...>
   assert (idim_out>=0 && idim_out<field.extent_int(1));
   assert (start_dim+num_dims<=field.extent_int(2));
   assert (m_num_2d_fields+num_dims<=m_2d_fields.extent_int(1));
-  assert (m_num_1d_fields==0);
 
   {
     auto l_num_2d_fields = m_num_2d_fields;
@@ -428,7 +456,6 @@ void BoundaryExchange::register_field (ExecView<Scalar*[OUTER_DIM][DIM][NP][NP][
   assert (num_dims>0 && start_dim>=0 && outer_dim>=0 && DIM>0 && OUTER_DIM>0);
   assert (start_dim+num_dims<=DIM);
   assert (m_num_3d_fields+num_dims<=m_3d_fields.extent_int(1));
-  assert (m_num_1d_fields==0);
 
   {
     auto l_num_3d_fields = m_num_3d_fields;
@@ -453,7 +480,6 @@ void BoundaryExchange::register_field (ExecView<Scalar***[NP][NP][NUM_LEV], Prop
   assert (num_dims>0 && start_dim>=0 && outer_dim>=0);
   assert (start_dim+num_dims<=field.extent_int(2));
   assert (m_num_3d_fields+num_dims<=m_3d_fields.extent_int(1));
-  assert (m_num_1d_fields==0);
 
   {
     auto l_num_3d_fields = m_num_3d_fields;
@@ -480,7 +506,6 @@ void BoundaryExchange::register_field_impl (
   // Sanity checks
   assert (m_registration_started && !m_registration_completed);
   assert (m_num_3d_fields+1<=m_3d_fields.extent_int(1));
-  assert (m_num_1d_fields==0);
 
   {
     auto l_num_3d_fields = m_num_3d_fields;
@@ -507,7 +532,6 @@ void BoundaryExchange::register_field_impl (
   // Sanity checks
   assert (m_registration_started && !m_registration_completed);
   assert (m_num_3d_int_fields+1<=m_3d_int_fields.extent_int(1));
-  assert (m_num_1d_fields==0);
 
   Errors::runtime_check(
     nlev == NUM_LEV_IN,
@@ -554,7 +578,6 @@ void BoundaryExchange::register_field_impl (
   assert (num_dims>0 && start_dim>=0);
   assert (start_dim+num_dims<=field.extent_int(1));
   assert (m_num_3d_fields+num_dims<=m_3d_fields.extent_int(1));
-  assert (m_num_1d_fields==0);
 
   {
     RegisterFieldImpl<Properties...> f;
@@ -586,7 +609,6 @@ void BoundaryExchange::register_field_impl (
   assert (num_dims>0 && start_dim>=0);
   assert (start_dim+num_dims<=field.extent_int(1));
   assert (m_num_3d_int_fields+1<=m_3d_int_fields.extent_int(1));
-  assert (m_num_1d_fields==0);
 
   Errors::runtime_check(
     nlev == NUM_LEV_IN,
@@ -613,7 +635,7 @@ void BoundaryExchange::register_min_max_fields (ExecView<Scalar*[DIM][2][NUM_LEV
 
   // Sanity checks
   assert(m_registration_started && !m_registration_completed);
-  assert(m_num_2d_fields == 0 && m_num_3d_fields == 0);
+  assert(m_num_1d_fields+num_dims<=m_1d_fields.extent_int(1));
 
   {
     auto l_num_1d_fields = m_num_1d_fields;
@@ -313,6 +313,25 @@ void Connectivity::setup_ucon () {
   }
 }
 
+void Connectivity::get_boundary_and_interior_elements (std::vector<int>& boundary,
+                                                        std::vector<int>& interior) const
+{
+  assert (m_finalized);
+
+  boundary.clear();
+  interior.clear();
+  for (int ie = 0; ie < m_num_local_elements; ++ie) {
+    bool is_boundary = false;
+    for (int k = h_ucon_ptr(ie); k < h_ucon_ptr(ie+1); ++k) {
+      if (h_ucon(k).sharing == etoi(ConnectionSharing::SHARED)) {
+        is_boundary = true;
+        break;
+      }
+    }
+    (is_boundary ? boundary : interior).push_back(ie);
+  }
+}
+
 void Connectivity::clean_up()
 {
   // Cleaning the elements counter
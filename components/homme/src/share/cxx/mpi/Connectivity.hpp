@@ -11,6 +11,8 @@
 #include "Comm.hpp"
 #include "Types.hpp"
 
+#include <vector>
+
 namespace Homme
 {
 struct LidGidPos
@@ -125,6 +127,12 @@ public:
   int get_num_local_elements     () const { return m_num_local_elements;  }
   int get_max_corner_elements    () const { return m_max_corner_elements; }
 
+  // Split the local elements into those with at least one connection to an element
+  // owned by a remote process (boundary), and those without any (interior).
+  // The latter are not needed for the MPI part of a boundary exchange.
+  void get_boundary_and_interior_elements (std::vector<int>& boundary,
+                                           std::vector<int>& interior) const;
+
   bool is_initialized () const { return m_initialized; }
   bool is_finalized   () const { return m_finalized;   }
 
@@ -8,6 +8,7 @@
 
 #include "BoundaryExchange.hpp"
 #include "Connectivity.hpp"
+#include "ExecSpaceDefs.hpp"
 
 namespace Homme
 {
@@ -18,6 +19,9 @@ MpiBuffersManager::MpiBuffersManager ()
  , m_local_buffer_size (0)
  , m_buffers_busy      (false)
  , m_views_are_valid   (false)
+ , m_use_shared_memory (false)
+ , m_node_comm         (MPI_COMM_NULL)
+ , m_shm_win           (MPI_WIN_NULL)
 {
   // The "fake" buffers used for MISSING connections. These do not depend on the requirements
   // from the custormers, so we can create them right away.
@@ -41,6 +45,16 @@ MpiBuffersManager::~MpiBuffersManager ()
 
   // Check our buffers are not busy
   assert (!m_buffers_busy);
+
+  // If MPI is already finalized, there's nothing we can (or need to) free
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (!finalized) {
+    free_shared_memory_window();
+    if (m_node_comm!=MPI_COMM_NULL) {
+      MPI_Comm_free(&m_node_comm);
+    }
+  }
 }
 
 void MpiBuffersManager::check_for_reallocation ()
@@ -58,6 +72,64 @@ void MpiBuffersManager::set_connectivity (std::shared_ptr<Connectivity> connecti
   m_connectivity = connectivity;
 }
 
+void MpiBuffersManager::set_use_shared_memory (const bool use_shared_memory)
+{
+  // We need the comm from the connectivity
+  assert (m_connectivity);
+
+  // Views must be reallocated in (or out of) the shared window
+  m_views_are_valid = m_views_are_valid && (use_shared_memory==m_use_shared_memory);
+
+  m_use_shared_memory = false;
+  if (!use_shared_memory || OnGpu<ExecSpace>::value) {
+    // The pack/unpack kernels on GPU can't access the (host) shared window
+    return;
+  }
+
+  const auto comm = m_connectivity->get_comm();
+  if (m_node_comm==MPI_COMM_NULL) {
+    MPI_Comm_split_type(comm.mpi_comm(),MPI_COMM_TYPE_SHARED,comm.rank(),MPI_INFO_NULL,&m_node_comm);
+  }
+  int node_size;
+  MPI_Comm_size(m_node_comm,&node_size);
+
+  // Map each pid in the connectivity comm to its rank in the node comm
+  std::vector<int> pids(comm.size());
+  m_node_ranks.resize(comm.size());
+  for (int pid=0; pid<comm.size(); ++pid) {
+    pids[pid] = pid;
+  }
+  MPI_Group group, node_group;
+  MPI_Comm_group(comm.mpi_comm(),&group);
+  MPI_Comm_group(m_node_comm,&node_group);
+  MPI_Group_translate_ranks(group,comm.size(),pids.data(),node_group,m_node_ranks.data());
+  MPI_Group_free(&group);
+  MPI_Group_free(&node_group);
+
+  // With one rank per node there is nobody to share memory with. Since all
+  // the ranks on a node get the same answer, this keeps node collectives consistent.
+  m_use_shared_memory = node_size>1;
+}
+
+Real* MpiBuffersManager::get_node_send_buffer (const int node_rank) const
+{
+  assert (m_use_shared_memory && m_shm_win!=MPI_WIN_NULL);
+
+  MPI_Aint size;
+  int disp_unit;
+  Real* ptr;
+  MPI_Win_shared_query(m_shm_win,node_rank,&size,&disp_unit,&ptr);
+  return ptr;
+}
+
+void MpiBuffersManager::free_shared_memory_window ()
+{
+  if (m_shm_win!=MPI_WIN_NULL) {
+    MPI_Win_unlock_all(m_shm_win);
+    MPI_Win_free(&m_shm_win);
+  }
+}
+
 bool MpiBuffersManager::check_views_capacity (const int num_1d_fields, const int num_2d_fields, const int num_3d_fields, const int num_3d_interface_fields) const
 {
   size_t mpi_buffer_size, local_buffer_size;
@@ -69,6 +141,14 @@ bool MpiBuffersManager::check_views_capacity (const int num_1d_fields, const int
 
 void MpiBuffersManager::allocate_buffers ()
 {
+  // With shared memory, the window allocation is collective over the node,
+  // so all the ranks on the node must agree on whether to reallocate.
+  if (m_use_shared_memory) {
+    int valid = m_views_are_valid ? 1 : 0;
+    MPI_Allreduce(MPI_IN_PLACE,&valid,1,MPI_INT,MPI_LAND,m_node_comm);
+    m_views_are_valid = valid==1;
+  }
+
   // If views are marked as valid, they are already allocated, and no other
   // customer has requested a larger size
   if (m_views_are_valid) {
@@ -76,7 +156,19 @@ void MpiBuffersManager::allocate_buffers ()
   }
 
   // The buffers used for packing/unpacking
-  m_send_buffer  = ExecViewManaged<Real*>("send buffer",  m_mpi_buffer_size);
+  free_shared_memory_window();
+  if (m_use_shared_memory) {
+    // The send buffer lives in the node shared window, so that on-node
+    // neighbors can read it. We keep a passive target epoch open on all
+    // ranks, and use MPI_Win_sync (plus a message) to order reads/writes.
+    Real* ptr;
+    MPI_Win_allocate_shared(m_mpi_buffer_size*sizeof(Real),sizeof(Real),MPI_INFO_NULL,
+                            m_node_comm,&ptr,&m_shm_win);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK,m_shm_win);
+    m_send_buffer = ExecViewManaged<Real*>(ptr,m_mpi_buffer_size);
+  } else {
+    m_send_buffer = ExecViewManaged<Real*>("send buffer",  m_mpi_buffer_size);
+  }
   m_recv_buffer  = ExecViewManaged<Real*>("recv buffer",  m_mpi_buffer_size);
   m_local_buffer = ExecViewManaged<Real*>("local buffer", m_local_buffer_size);
 
@@ -9,6 +9,8 @@
 
 #include "Types.hpp"
 
+#include <mpi.h>
+
 #include <vector>
 #include <map>
 #include <memory>
@@ -70,6 +72,14 @@ class BoundaryExchange;
  * which is a no-op if the MPIMemSpace=ExecMemSpace, that is, if
  * the MPI is performed using pointers on the Execution Space.
  *
+ * Optionally (see set_use_shared_memory), on CPU builds the send buffer
+ * can be allocated in an MPI-3 shared memory window, spanning all the
+ * ranks on the same node. In this case, BE customers read the data sent
+ * by on-node neighbors directly from the neighbor's send buffer, and
+ * MPI is used only to signal when the data is ready/consumed.
+ * NOTE: when shared memory is used, allocate_buffers is collective over
+ *       the ranks on the same node.
+ *
  */
 
 class MpiBuffersManager
@@ -99,6 +109,21 @@ public:
   // Allocate the buffers (overwriting possibly already allocated ones if needed)
   void allocate_buffers ();
 
+  // Use an MPI-3 shared memory window for the send buffer, so that on-node
+  // neighbors can read from it directly. Collective over the connectivity comm.
+  // This is a no-op on GPU builds, or if there is only one rank per node.
+  void set_use_shared_memory (const bool use_shared_memory);
+  bool uses_shared_memory () const { return m_use_shared_memory; }
+
+  // The rank of pid in the node comm (MPI_UNDEFINED if pid is on another node)
+  int get_node_rank (const int pid) const;
+
+  // The send buffer of the given rank of the node comm
+  Real* get_node_send_buffer (const int node_rank) const;
+
+  // Memory barrier for the shared memory window (no-op if not using shared memory)
+  void sync_shared_memory () const;
+
   // Lock/unlock the buffers are busy
   void lock_buffers ();
   void unlock_buffers ();
@@ -145,6 +170,9 @@ private:
   // Note: this method does not (re)allocate views
   void update_requested_sizes (std::map<BoundaryExchange*,CustomerNeeds>::value_type& customer);
 
+  // Free the shared memory window (if any)
+  void free_shared_memory_window ();
+
   // Computes the required storages
   void required_buffer_sizes (const int num_1d_fields, const int num_2d_fields,
                               const int num_3d_fields, const int num_3d_interface_fields,
@@ -181,6 +209,13 @@ private:
   // The blackhole send/recv buffers (used for missing connections)
   ExecViewManaged<Real*>  m_blackhole_send_buffer;
   ExecViewManaged<Real*>  m_blackhole_recv_buffer;
+
+  // Shared memory support: the node comm, the pid->node rank map, and
+  // the window storing the send buffer
+  bool              m_use_shared_memory;
+  MPI_Comm          m_node_comm;
+  MPI_Win           m_shm_win;
+  std::vector<int>  m_node_ranks;
 };
 
 inline void MpiBuffersManager::sync_send_buffer (BoundaryExchange* customer)
@@ -215,6 +250,19 @@ inline void MpiBuffersManager::sync_recv_buffer (BoundaryExchange* customer)
   }
 }
 
+inline int MpiBuffersManager::get_node_rank (const int pid) const
+{
+  assert (m_use_shared_memory);
+  return m_node_ranks[pid];
+}
+
+inline void MpiBuffersManager::sync_shared_memory () const
+{
+  if (m_use_shared_memory) {
+    MPI_Win_sync(m_shm_win);
+  }
+}
+
 inline ExecViewUnmanaged<Real*>
 MpiBuffersManager::get_send_buffer () const
 {
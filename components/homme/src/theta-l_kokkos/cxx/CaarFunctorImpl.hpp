@@ -20,6 +20,7 @@
 #include "RKStageData.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "ThreadsTuner.hpp"
 #include "kokkos_utils.hpp"
 
 #include "mpi/BoundaryExchange.hpp"
@@ -31,6 +32,7 @@
 #include "ErrorDefs.hpp"
 
 #include <assert.h>
+#include <vector>
 
 namespace Homme {
 
@@ -92,6 +94,7 @@ struct CaarFunctorImpl {
   const bool          m_theta_hydrostatic_mode;
   const AdvectionForm m_theta_advection_form;
   const bool          m_pgrad_correction;
+  const bool          m_overlap_exchange;
 
   HybridVCoord          m_hvcoord;
   ElementsState         m_state;
@@ -104,6 +107,7 @@ struct CaarFunctorImpl {
   SphereOperators       m_sphere_ops;
 
   struct TagPreExchange {};
+  struct TagPreExchangeSubset {};
   struct TagPostExchange {};
 
   // Policies
@@ -123,6 +127,13 @@ struct CaarFunctorImpl {
 
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, NUM_TIME_LEVELS> m_bes;
 
+  // When overlapping the boundary exchange with computations, the elements
+  // with a neighbor on a remote process are computed first, and the interior
+  // ones are computed while the MPI messages are in flight.
+  ExecViewManaged<int*>          m_boundary_elems;
+  ExecViewManaged<int*>          m_interior_elems;
+  ExecViewUnmanaged<const int*>  m_elems_subset;
+
   CaarFunctorImpl(const Elements &elements, const Tracers &/* tracers */,
                   const ReferenceElement &ref_FE, const HybridVCoord &hvcoord,
                   const SphereOperators &sphere_ops, const SimulationParams& params)
@@ -131,6 +142,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+      , m_overlap_exchange(params.caar_overlap_exchange)
       , m_hvcoord(hvcoord)
       , m_state(elements.m_state)
       , m_derived(elements.m_derived)
@@ -154,6 +166,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+      , m_overlap_exchange(params.caar_overlap_exchange)
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
       , m_policy_post (0,num_elems*NP*NP)
       , m_tu(m_policy_pre)
@@ -323,6 +336,16 @@ struct CaarFunctorImpl {
       }
       be.registration_completed();
     }
+
+    if (m_overlap_exchange) {
+      std::vector<int> boundary, interior;
+      bm_exchange->get_connectivity()->get_boundary_and_interior_elements(boundary,interior);
+
+      m_boundary_elems = ExecViewManaged<int*>("CAAR boundary elems",boundary.size());
+      m_interior_elems = ExecViewManaged<int*>("CAAR interior elems",interior.size());
+      Kokkos::deep_copy(m_boundary_elems,HostViewUnmanaged<const int*>(boundary.data(),boundary.size()));
+      Kokkos::deep_copy(m_interior_elems,HostViewUnmanaged<const int*>(interior.data(),interior.size()));
+    }
   }
 
   void set_rk_stage_data (const RKStageData& data) {
@@ -345,18 +368,30 @@ struct CaarFunctorImpl {
 
     profiling_resume();
 
-    GPTLstart("caar compute");
-    int nerr;
-    Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
-    Kokkos::fence();
-    GPTLstop("caar compute");
-    if (nerr > 0)
-      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+    if (m_overlap_exchange) {
+      run_pre_exchange_overlapped(data);
+    } else {
+      // Let the tuner pick the team size; m_tu must match the policy we launch
+      auto& tuner = Context::singleton().create_if_not_there<ThreadsTuner>();
+      const auto policy = ThreadsTuner::with_team_size(m_policy_pre,
+          tuner.team_size("caar", m_num_elems, m_policy_pre.team_size()));
+      m_tu = TeamUtils<ExecSpace>(policy);
 
-    GPTLstart("caar_bexchV");
-    m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
-    Kokkos::fence();
-    GPTLstop("caar_bexchV");
+      GPTLstart("caar compute");
+      tuner.start("caar");
+      int nerr;
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange", policy, *this, nerr);
+      Kokkos::fence();
+      tuner.stop("caar");
+      GPTLstop("caar compute");
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+
+      GPTLstart("caar_bexchV");
+      m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop("caar_bexchV");
+    }
 
     if (!m_theta_hydrostatic_mode) {
       GPTLstart("caar compute");
@@ -370,12 +405,73 @@ struct CaarFunctorImpl {
     profiling_pause();
   }
 
+  // Same as the pre-exchange part of run, but the pack/send of the boundary exchange
+  // is posted as soon as the elements on the process boundary are computed, so
+  // that the MPI messages are in flight while the interior elements are computed.
+  void run_pre_exchange_overlapped (const RKStageData& data)
+  {
+    auto& be = *m_bes[data.np1];
+
+    GPTLstart("caar compute");
+    int nerr = run_pre_exchange_on_subset(m_boundary_elems);
+    GPTLstop("caar compute");
+
+    GPTLstart("caar_bexchV");
+    be.pack_and_send_shared();
+    GPTLstop("caar_bexchV");
+
+    GPTLstart("caar compute");
+    nerr += run_pre_exchange_on_subset(m_interior_elems);
+    GPTLstop("caar compute");
+    if (nerr > 0)
+      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+
+    GPTLstart("caar_bexchV");
+    const ExecViewUnmanaged<const Real * [NP][NP]> rspheremp = m_geometry.m_rspheremp;
+    be.pack_local();
+    be.recv_and_unpack(&rspheremp);
+    Kokkos::fence();
+    GPTLstop("caar_bexchV");
+  }
+
+  int run_pre_exchange_on_subset (const ExecViewManaged<int*>& elems)
+  {
+    int nerr = 0;
+    const int num_elems = elems.extent_int(0);
+    if (num_elems==0) {
+      return nerr;
+    }
+
+    // Use the same team/vector sizes as m_policy_pre, since the workspace
+    // indices handed out by m_tu depend on them
+    const auto threads_vectors =
+      DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(m_num_elems);
+    TeamPolicyType<TagPreExchangeSubset> policy(num_elems,threads_vectors.first,threads_vectors.second);
+    policy.set_chunk_size(1);
+
+    m_elems_subset = elems;
+    Kokkos::parallel_reduce("caar loop pre-boundary exchange (subset)", policy, *this, nerr);
+    Kokkos::fence();
+    return nerr;
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator()(const TagPreExchange&, const TeamMember &team, int& nerr) const {
-    // In this body, we use '====' to separate sync epochs (delimited by barriers)
-    // Note: make sure the same temp is not used within each epoch!
+    KernelVariables kv(team, m_tu);
+    compute_pre_exchange(kv, nerr);
+  }
 
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagPreExchangeSubset&, const TeamMember &team, int& nerr) const {
     KernelVariables kv(team, m_tu);
+    kv.ie = m_elems_subset(team.league_rank());
+    compute_pre_exchange(kv, nerr);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void compute_pre_exchange (KernelVariables& kv, int& nerr) const {
+    // In this body, we use '====' to separate sync epochs (delimited by barriers)
+    // Note: make sure the same temp is not used within each epoch!
 
     // =========== EPOCH 1 =========== //
     compute_div_vdp(kv);
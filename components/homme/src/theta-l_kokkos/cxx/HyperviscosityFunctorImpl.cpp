@@ -8,12 +8,15 @@
 
 #include "Context.hpp"
 #include "FunctorsBuffersManager.hpp"
+#include "ThreadsTuner.hpp"
 #include "profiling.hpp"
 
 #include "mpi/BoundaryExchange.hpp"
 #include "mpi/MpiBuffersManager.hpp"
 #include "mpi/Connectivity.hpp"
 
+#include <vector>
+
 namespace Homme
 {
 
@@ -122,6 +125,8 @@ void HyperviscosityFunctorImpl::init_params(const SimulationParams& params)
 #else
   m_process_nh_vars = !params.theta_hydrostatic_mode;
 #endif
+
+  m_overlap_exchange = params.hv_overlap_exchange;
 }
 
 void HyperviscosityFunctorImpl::setup(const ElementsGeometry&     geometry,
@@ -224,6 +229,16 @@ void HyperviscosityFunctorImpl::init_boundary_exchanges () {
     be->register_field(m_buffers.vtens, 2, 0, nlev);
     be->registration_completed();
   }
+
+  if (m_overlap_exchange) {
+    std::vector<int> boundary, interior;
+    bm_exchange->get_connectivity()->get_boundary_and_interior_elements(boundary,interior);
+
+    m_boundary_elems = ExecViewManaged<int*>("HV boundary elems",boundary.size());
+    m_interior_elems = ExecViewManaged<int*>("HV interior elems",interior.size());
+    Kokkos::deep_copy(m_boundary_elems,HostViewUnmanaged<const int*>(boundary.data(),boundary.size()));
+    Kokkos::deep_copy(m_interior_elems,HostViewUnmanaged<const int*>(interior.data(),interior.size()));
+  }
 }//initBE
 
 void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real eta_ave_w)
@@ -266,24 +281,42 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   });
   Kokkos::fence();
 
+  // Let the tuner pick the team size of the subcycle kernels. The overlapped
+  // path launches on subsets with the default team size, so it is not tuned.
+  auto& tuner = Context::singleton().create_if_not_there<ThreadsTuner>();
+  if (!m_overlap_exchange) {
+    const auto threads_vectors =
+      DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(m_num_elems);
+    set_team_size(tuner.team_size("hv", m_num_elems, threads_vectors.first));
+  }
+
+  // The exchanges are timed too, but they do not depend on the team size
+  tuner.start("hv");
   for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
-    GPTLstart("hvf-bhwk");
-    biharmonic_wk_theta ();
-    GPTLstop("hvf-bhwk");
+    if (m_overlap_exchange) {
+      GPTLstart("hvf-bhwk");
+      biharmonic_wk_theta_overlapped ();
+      GPTLstop("hvf-bhwk");
+    } else {
+      GPTLstart("hvf-bhwk");
+      biharmonic_wk_theta ();
+      GPTLstop("hvf-bhwk");
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
-    Kokkos::fence();
+      Kokkos::parallel_for(m_policy_pre_exchange, *this);
+      Kokkos::fence();
 
-    // Exchange
-    assert (m_be->is_registration_completed());
-    GPTLstart("hvf-bexch");
-    m_be->exchange();
-    GPTLstop("hvf-bexch");
+      // Exchange
+      assert (m_be->is_registration_completed());
+      GPTLstart("hvf-bexch");
+      m_be->exchange();
+      GPTLstop("hvf-bexch");
+    }
 
     // Update states
     Kokkos::parallel_for(m_policy_update_states, *this);
     Kokkos::fence();
   } //subcycle
+  tuner.stop("hv");
 
   // Convert theta back to vtheta, and adjust w at surface
   auto geo = m_geometry;
@@ -350,7 +383,7 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   } // for sponge layer
 } // run()
 
-void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
+void HyperviscosityFunctorImpl::biharmonic_wk_theta()
 {
   // For the first laplacian we use a differnt kernel, which uses directly the states
   // at timelevel np1 as inputs, and subtracts the reference states.
@@ -366,16 +399,98 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
 
   // Compute second laplacian, tensor or const hv
   const int ne = m_geometry.num_elems();
+  // Same team size as m_policy_first_laplace, since m_tu was built for it
+  const int team_size = m_policy_first_laplace.team_size();
   if ( m_data.consthv ) {
-    auto policy = Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceConstHV>(ne);
+    auto policy = ThreadsTuner::with_team_size(
+        Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceConstHV>(ne), team_size);
     Kokkos::parallel_for(policy, *this);
   }else{
-    auto policy = Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceTensorHV>(ne);
+    auto policy = ThreadsTuner::with_team_size(
+        Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceTensorHV>(ne), team_size);
     Kokkos::parallel_for(policy, *this);
   }
   Kokkos::fence();
 } //biharmonic
 
+void HyperviscosityFunctorImpl::set_team_size (const int team_size)
+{
+  m_policy_update_states       = ThreadsTuner::with_team_size(m_policy_update_states, team_size);
+  m_policy_first_laplace       = ThreadsTuner::with_team_size(m_policy_first_laplace, team_size);
+  m_policy_pre_exchange        = ThreadsTuner::with_team_size(m_policy_pre_exchange, team_size);
+  m_policy_nutop_laplace       = ThreadsTuner::with_team_size(m_policy_nutop_laplace, team_size);
+  m_policy_nutop_update_states = ThreadsTuner::with_team_size(m_policy_nutop_update_states, team_size);
+  m_tu = TeamUtils<ExecSpace>(m_policy_update_states);
+}
+
+void HyperviscosityFunctorImpl::biharmonic_wk_theta_overlapped()
+{
+  assert (m_be->is_registration_completed());
+  const ExecViewUnmanaged<const Real*[NP][NP]> rspheremp = m_geometry.m_rspheremp;
+
+  // First laplacian: post the sends as soon as the process boundary is done
+  run_on_subset<TagFirstLaplaceHV>(m_boundary_elems);
+
+  GPTLstart("hvf-bexch");
+  m_be->pack_and_send_shared();
+  GPTLstop("hvf-bexch");
+
+  run_on_subset<TagFirstLaplaceHV>(m_interior_elems);
+
+  GPTLstart("hvf-bexch");
+  m_be->pack_local();
+  m_be->recv_and_unpack(&rspheremp);
+  Kokkos::fence();
+  GPTLstop("hvf-bexch");
+
+  // Second laplacian and pre-exchange kernel, same pattern
+  run_second_laplace_and_pre_exchange(m_boundary_elems);
+
+  GPTLstart("hvf-bexch");
+  m_be->pack_and_send_shared();
+  GPTLstop("hvf-bexch");
+
+  run_second_laplace_and_pre_exchange(m_interior_elems);
+
+  GPTLstart("hvf-bexch");
+  m_be->pack_local();
+  m_be->recv_and_unpack();
+  Kokkos::fence();
+  GPTLstop("hvf-bexch");
+} //biharmonic overlapped
+
+void HyperviscosityFunctorImpl::
+run_second_laplace_and_pre_exchange (const ExecViewManaged<int*>& elems)
+{
+  if ( m_data.consthv ) {
+    run_on_subset<TagSecondLaplaceConstHV>(elems);
+  } else {
+    run_on_subset<TagSecondLaplaceTensorHV>(elems);
+  }
+  run_on_subset<TagHyperPreExchange>(elems);
+}
+
+template<typename Tag>
+void HyperviscosityFunctorImpl::run_on_subset (const ExecViewManaged<int*>& elems)
+{
+  const int num_elems = elems.extent_int(0);
+  if (num_elems==0) {
+    return;
+  }
+
+  // Use the same team/vector sizes as the full policies, since the workspace
+  // indices handed out by m_tu depend on them
+  const auto threads_vectors =
+    DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(m_num_elems);
+  Kokkos::TeamPolicy<ExecSpace,Tag> policy(num_elems,threads_vectors.first,threads_vectors.second);
+  policy.set_chunk_size(1);
+
+  m_elems_subset = elems;
+  Kokkos::parallel_for(policy, *this);
+  Kokkos::fence();
+  m_elems_subset = ExecViewUnmanaged<const int*>();
+}
+
 // Laplace for nu_top
 KOKKOS_INLINE_FUNCTION
 void HyperviscosityFunctorImpl::operator() (const TagNutopLaplace&, const TeamMember& team) const {
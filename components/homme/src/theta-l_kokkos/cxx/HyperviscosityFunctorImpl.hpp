@@ -105,7 +105,20 @@ public:
 
   void run (const int np1, const Real dt, const Real eta_ave_w);
 
-  void biharmonic_wk_theta () const;
+  void biharmonic_wk_theta ();
+
+  // Same as biharmonic_wk_theta followed by the pre-exchange kernel and the
+  // second exchange, but each exchange is overlapped with the computation of
+  // the elements that have no neighbor on a remote process.
+  void biharmonic_wk_theta_overlapped ();
+
+  // When running a kernel on a subset of the elements, map the team to the element it processes
+  KOKKOS_INLINE_FUNCTION
+  void set_subset_elem (KernelVariables& kv) const {
+    if (m_elems_subset.size()>0) {
+      kv.ie = m_elems_subset(kv.team.league_rank());
+    }
+  }
 
   // first iter of laplace, const hv
   KOKKOS_INLINE_FUNCTION
@@ -113,6 +126,7 @@ public:
      using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
     KernelVariables kv(team, m_tu);
+    set_subset_elem(kv);
     // Subtract the reference states from the states
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
                          [&](const int idx) {
@@ -194,6 +208,7 @@ public:
   KOKKOS_INLINE_FUNCTION
   void operator() (const TagSecondLaplaceConstHV&, const TeamMember& team) const {
     KernelVariables kv(team, m_tu);
+    set_subset_elem(kv);
     // Laplacian of layers thickness
     m_sphere_ops.laplace_simple(kv,
                    Homme::subview(m_buffers.dptens,kv.ie),
@@ -223,6 +238,7 @@ public:
   KOKKOS_INLINE_FUNCTION
   void operator() (const TagSecondLaplaceTensorHV&, const TeamMember& team) const {
     KernelVariables kv(team, m_tu);
+    set_subset_elem(kv);
     // Laplacian of layers thickness
     m_sphere_ops.laplace_tensor(kv,
                    Homme::subview(m_geometry.m_tensorvisc,kv.ie),
@@ -316,6 +332,7 @@ public:
     using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
     KernelVariables kv(team, m_tu);
+    set_subset_elem(kv);
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
                          [&](const int &point_idx) {
       const int igp = point_idx / NP;
@@ -386,6 +403,16 @@ public:
 
 protected:
 
+  // Set the team size of all the policies that share m_tu, and rebuild m_tu
+  void set_team_size (const int team_size);
+
+  // Run the kernel for the given tag on a subset of the elements
+  template<typename Tag>
+  void run_on_subset (const ExecViewManaged<int*>& elems);
+
+  // Second laplacian and pre-exchange kernel on a subset of the elements
+  void run_second_laplace_and_pre_exchange (const ExecViewManaged<int*>& elems);
+
   const int             m_num_elems;
   HyperviscosityData    m_data;
   ElementsState         m_state;
@@ -398,6 +425,14 @@ protected:
   HybridVCoord          m_hvcoord;
 
   bool m_process_nh_vars;
+  bool m_overlap_exchange;
+
+  // When overlapping the boundary exchanges with computations, the elements
+  // with a neighbor on a remote process are computed first, and the interior
+  // ones are computed while the MPI messages are in flight.
+  ExecViewManaged<int*>          m_boundary_elems;
+  ExecViewManaged<int*>          m_interior_elems;
+  ExecViewUnmanaged<const int*>  m_elems_subset;
 
   // Policies
   Kokkos::TeamPolicy<ExecSpace,TagUpdateStates>     m_policy_update_states;
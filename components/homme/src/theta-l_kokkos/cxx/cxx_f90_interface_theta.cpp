@@ -21,6 +21,7 @@
 #include "ReferenceElement.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "ThreadsTuner.hpp"
 #include "TimeLevel.hpp"
 #include "Tracers.hpp"
 #include "GllFvRemap.hpp"
@@ -47,7 +48,9 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
                                const bool& use_cpstar, const int& transport_alg, const bool& theta_hydrostatic_mode, const char** test_case,
                                const int& dt_remap_factor, const int& dt_tracer_factor,
                                const double& scale_factor, const double& laplacian_rigid_factor, const int& nsplit, const bool& pgrad_correction,
-                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level)
+                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level,
+                               const bool& caar_overlap_exchange, const bool& be_use_shared_memory,
+                               const bool& hv_overlap_exchange, const bool& autotune_threads)
 {
   // Check that the simulation options are supported. This helps us in the future, since we
   // are currently 'assuming' some option have/not have certain values. As we support for more
@@ -124,6 +127,10 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
   params.dp3d_thresh                   = dp3d_thresh;
   params.vtheta_thresh                 = vtheta_thresh;
   params.internal_diagnostics_level    = internal_diagnostics_level;
+  params.caar_overlap_exchange         = caar_overlap_exchange;
+  params.be_use_shared_memory          = be_use_shared_memory;
+  params.hv_overlap_exchange           = hv_overlap_exchange;
+  params.autotune_threads              = autotune_threads;
 
   if (time_step_type==5) {
     //5 stage, 3rd order, explicit
@@ -345,6 +352,12 @@ void init_functors_c (const bool& allocate_buffer)
   Errors::runtime_check(hvcoord.m_inited,  "Error! You must initialize the HybridVCoord structure before initializing the functors.\n", -1);
   Errors::runtime_check(params.params_set, "Error! You must initialize the SimulationParams structure before initializing the functors.\n", -1);
 
+  // The functors ask the tuner for their team sizes at run time. The choices
+  // are made collectively, and root writes the cache file at finalization.
+  if (params.autotune_threads) {
+    c.create_if_not_there<ThreadsTuner>().enable(c.get<Comm>(),"hommexx_threads_tuning.txt");
+  }
+
   // First, sphere operators, then the others
   auto& sph_op = c.create<SphereOperators>(elems.m_geometry,ref_FE);
   auto& limiter = c.create_if_not_there<LimiterFunctor>(elems,hvcoord,params);
@@ -580,6 +593,8 @@ void init_boundary_exchanges_c ()
   if (!bmm[MPI_EXCHANGE_MIN_MAX]->is_connectivity_set()) {
     bmm[MPI_EXCHANGE_MIN_MAX]->set_connectivity(connectivity);
   }
+  bmm[MPI_EXCHANGE]->set_use_shared_memory(params.be_use_shared_memory);
+  bmm[MPI_EXCHANGE_MIN_MAX]->set_use_shared_memory(params.be_use_shared_memory);
 
   if (params.qsize > 0) {
     if (params.transport_alg == 0) {
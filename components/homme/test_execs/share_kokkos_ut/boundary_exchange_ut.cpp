@@ -51,7 +51,7 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   std::uniform_int_distribution<int>   dint(0,1);
 
   constexpr int ne        = 2;
-  constexpr int num_tests = 1;
+  constexpr int num_tests = 3; // Cycle through the split/batched exchange variants below
   constexpr int DIM       = 2;
   constexpr double test_tolerance = 1e-13;
   constexpr int num_min_max_fields_1d = 1; // Count min and max of a field as 1, does not count the x2 due to min and max
@@ -112,10 +112,16 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   std::shared_ptr<MpiBuffersManager> buffers_manager = Context::singleton().get<MpiBuffersManagerMap>()[MPI_EXCHANGE];
   std::shared_ptr<MpiBuffersManager> buffers_manager_min_max = Context::singleton().get<MpiBuffersManagerMap>()[MPI_EXCHANGE_MIN_MAX];
 
+  // Use the shared memory path for the min/max exchange (if supported), and
+  // the standard MPI path for the other exchanges, so that both are tested.
+  buffers_manager_min_max->set_use_shared_memory(true);
+
   // Create boundary exchanges
   std::shared_ptr<BoundaryExchange> be1 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
   std::shared_ptr<BoundaryExchange> be2 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
   std::shared_ptr<BoundaryExchange> be3 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager_min_max);
+  // Batched exchange: same fields as be2 and be3, in a single message per neighbor
+  std::shared_ptr<BoundaryExchange> be4 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
 
   // Setup the be objects
   be1->set_num_fields(0,num_scalar_fields_2d,DIM*num_vector_fields_3d);
@@ -132,6 +138,12 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   be3->register_min_max_fields(field_1d_cxx,num_min_max_fields_1d,0);
   be3->registration_completed();
 
+  be4->set_num_fields(num_min_max_fields_1d,0,num_scalar_fields_3d,num_scalar_interface_fields_3d);
+  be4->register_field(field_3d_cxx,1,field_3d_idim);
+  be4->register_field(field_3d_int_cxx,1,field_3d_idim);
+  be4->register_min_max_fields(field_1d_cxx,num_min_max_fields_1d,0);
+  be4->registration_completed();
+
   for (int itest=0; itest<num_tests; ++itest)
   {
     // Whether the neighbor min/max should be done as a whole or with two separate calls (start/pack_and_send and finish/recv_and_unpack)
@@ -209,11 +221,23 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
       be1->exchange();
       be2->exchange();
       be3->exchange_min_max();
+    } else if (itest % 3 == 2) {
+      be1->exchange();
+      // Pack/send the remote connections first, then the local ones
+      be4->pack_and_send_shared();
+      be4->pack_local();
+      be4->recv_and_unpack();
     } else {
       be3->pack_and_send_min_max();
       be1->pack_and_send();
       be1->recv_and_unpack();
-      be2->pack_and_send();
+      if (itest % 2 == 0) {
+        be2->pack_and_send();
+      } else {
+        // Pack/send the remote connections first, then the local ones
+        be2->pack_and_send_shared();
+        be2->pack_local();
+      }
       be2->recv_and_unpack();
       be3->recv_and_unpack_min_max();
     }
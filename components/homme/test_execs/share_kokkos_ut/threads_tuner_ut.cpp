@@ -0,0 +1,135 @@
+#include <catch2/catch.hpp>
+
+#include "ThreadsTuner.hpp"
+#include "Context.hpp"
+#include "mpi/Comm.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Homme;
+
+namespace {
+
+constexpr int pool_size   = 8;
+constexpr int num_trials  = 2;
+constexpr int league_size = 100;
+
+const std::string cache_file = "threads_tuner_ut_cache.txt";
+
+bool file_exists (const std::string& name) {
+  return std::ifstream(name).good();
+}
+
+// Run the tuning of kernel 'name', making all candidates but 'fastest' slow on
+// root. On the other ranks all candidates are equally fast, so that only the
+// reduction over the ranks can make them pick 'fastest'.
+std::vector<int> tune (ThreadsTuner& tuner, const std::string& name,
+                       const int fastest, const bool root) {
+  std::vector<int> sizes;
+  for (int n=0; n<4*num_trials; ++n) {
+    const int ts = tuner.team_size(name,league_size,1);
+    sizes.push_back(ts);
+    tuner.start(name);
+    if (root && ts!=fastest) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    tuner.stop(name);
+  }
+  return sizes;
+}
+
+} // anonymous namespace
+
+TEST_CASE("threads_tuner", "threads_tuner") {
+  if (OnGpu<ExecSpace>::value) {
+    // The tuner is a no-op on GPU
+    return;
+  }
+
+  const auto& comm = Context::singleton().get<Comm>();
+  if (comm.root()) {
+    std::remove(cache_file.c_str());
+  }
+  MPI_Barrier(comm.mpi_comm());
+
+  SECTION ("candidate_selection") {
+    ThreadsTuner tuner;
+    tuner.enable(comm,cache_file,num_trials,pool_size);
+
+    // Candidates are the default team size (1) and the divisors of the pool
+    // larger than it, cycled num_trials times
+    const auto sizes = tune(tuner,"k",4,comm.root());
+    const std::vector<int> expected = {1,2,4,8,1,2,4,8};
+    REQUIRE (sizes==expected);
+
+    // The choice is the same on all ranks, and is kept for the rest of the run
+    const int best = tuner.team_size("k",league_size,1);
+    REQUIRE (best==4);
+    int min_best, max_best;
+    MPI_Allreduce(&best,&min_best,1,MPI_INT,MPI_MIN,comm.mpi_comm());
+    MPI_Allreduce(&best,&max_best,1,MPI_INT,MPI_MAX,comm.mpi_comm());
+    REQUIRE (min_best==max_best);
+    REQUIRE (tuner.team_size("k",league_size,1)==4);
+
+    // A default team size larger than the pool leaves nothing to tune
+    REQUIRE (tuner.team_size("k16",league_size,16)==16);
+
+    // Nothing is written until finalize
+    REQUIRE (!file_exists(cache_file));
+    tuner.finalize();
+    MPI_Barrier(comm.mpi_comm());
+    REQUIRE (file_exists(cache_file));
+  }
+
+  SECTION ("cache_round_trip") {
+    {
+      ThreadsTuner tuner;
+      tuner.enable(comm,cache_file,num_trials,pool_size);
+      tune(tuner,"k",8,comm.root());
+      REQUIRE (tuner.team_size("k",league_size,1)==8);
+      tuner.finalize();
+      MPI_Barrier(comm.mpi_comm());
+    }
+
+    if (comm.root()) {
+      std::ifstream f(cache_file);
+      std::string line;
+      int nlines = 0;
+      while (std::getline(f,line)) {
+        ++nlines;
+        REQUIRE (line.substr(line.size()-6)==" 100 8");
+      }
+      REQUIRE (nlines==1);
+    }
+
+    ThreadsTuner tuner;
+    tuner.enable(comm,cache_file,num_trials,pool_size);
+
+    // A league size within a factor 2 of the cached one uses the cached choice
+    // right away, without tuning
+    REQUIRE (tuner.team_size("k",league_size,1)==8);
+    REQUIRE (tuner.team_size("k",3*league_size/2,1)==8);
+
+    // Unless it is not valid for the default team size
+    REQUIRE (tuner.team_size("k",league_size/2,16)==16);
+
+    // A league size further away, or a different pool size, starts a new tuning
+    REQUIRE (tuner.team_size("k",3*league_size,1)==1);
+    ThreadsTuner other_pool;
+    other_pool.enable(comm,cache_file,num_trials,2*pool_size);
+    REQUIRE (other_pool.team_size("k",league_size,1)==1);
+
+    // Nothing new was picked, so finalize leaves the file alone
+    if (comm.root()) {
+      std::remove(cache_file.c_str());
+    }
+    tuner.finalize();
+    MPI_Barrier(comm.mpi_comm());
+    REQUIRE (!file_exists(cache_file));
+  }
+}
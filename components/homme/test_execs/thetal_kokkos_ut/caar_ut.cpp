@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include <random>
+#include <tuple>
 
 #include "Types.hpp"
 #include "Context.hpp"
@@ -439,6 +440,73 @@ TEST_CASE("caar", "caar_testing") {
     }
   }
 
+  SECTION ("caar_overlap_exchange") {
+    // Overlapping the boundary exchange with the interior elements must not change the results
+    for (const bool hydrostatic : {true,false}) {
+      params.theta_hydrostatic_mode = hydrostatic;
+      params.theta_adv_form = AdvectionForm::Conservative;
+      params.rsplit = 3;
+
+      Real dt = RPDF(1.0,10.0)(engine);
+      int  np1 = IPDF(0,2)(engine);
+      auto mpi_comm = Context::singleton().get<Comm>().mpi_comm();
+      MPI_Bcast(&dt,1,MPI_DOUBLE,0,mpi_comm);
+      MPI_Bcast(&np1,1,MPI_INT,0,mpi_comm);
+      const int  n0  = (np1+1)%3;
+      const int  nm1 = (np1+2)%3;
+      RKStageData data (nm1, n0, np1, 0, dt, 1.0, 1.0, 1.0, 1.0);
+
+      // Run caar from the same (random) state, and return the updated state
+      auto run = [&](const bool overlap) {
+        params.caar_overlap_exchange = overlap;
+
+        elems.m_state.randomize(seed,max_pressure,hvcoord.ps0,hvcoord.hybrid_ai0,geo.m_phis);
+        elems.m_derived.randomize(seed,dp3d_min(elems.m_state.m_dp3d));
+
+        CaarFunctorImpl caar(elems,tracers,ref_FE,hvcoord,sphop,params);
+        FunctorsBuffersManager fbm;
+        fbm.request_size( caar.requested_buffer_size() );
+        fbm.allocate();
+        caar.init_buffers(fbm);
+        caar.init_boundary_exchanges(c.get_ptr<MpiBuffersManager>());
+
+        caar.run(data);
+
+        ScalarStateF90    dp3d("",num_elems);
+        ScalarStateF90    vtheta_dp("",num_elems);
+        ScalarStateIntF90 w_i("",num_elems);
+        ScalarStateIntF90 phinh_i("",num_elems);
+        VectorStateF90    v("",num_elems);
+        sync_to_host(elems.m_state.m_dp3d, dp3d);
+        sync_to_host(elems.m_state.m_vtheta_dp, vtheta_dp);
+        sync_to_host(elems.m_state.m_w_i, w_i);
+        sync_to_host(elems.m_state.m_phinh_i, phinh_i);
+        sync_to_host(elems.m_state.m_v, v);
+        return std::make_tuple(dp3d,vtheta_dp,w_i,phinh_i,v);
+      };
+
+      const auto ref = run(false);
+      const auto tst = run(true);
+
+      auto check = [&](const Real* ref_data, const Real* tst_data, const int size, const std::string& name) {
+        for (int i=0; i<size; ++i) {
+          if (ref_data[i]!=tst_data[i]) {
+            printf("rank %d, %s[%d]:\n",rank,name.c_str(),i);
+            printf("  no overlap: %3.40f\n",ref_data[i]);
+            printf("  overlap   : %3.40f\n",tst_data[i]);
+          }
+          REQUIRE(ref_data[i]==tst_data[i]);
+        }
+      };
+      check(std::get<0>(ref).data(),std::get<0>(tst).data(),std::get<0>(ref).size(),"dp3d");
+      check(std::get<1>(ref).data(),std::get<1>(tst).data(),std::get<1>(ref).size(),"vtheta_dp");
+      check(std::get<2>(ref).data(),std::get<2>(tst).data(),std::get<2>(ref).size(),"w_i");
+      check(std::get<3>(ref).data(),std::get<3>(tst).data(),std::get<3>(ref).size(),"phinh_i");
+      check(std::get<4>(ref).data(),std::get<4>(tst).data(),std::get<4>(ref).size(),"v");
+    }
+    params.caar_overlap_exchange = false;
+  }
+
   SECTION ("limiter_dp3d") {
 
     // rsplit and hydro_mode are irrelevant for this test, so just pick something
@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include <random>
+#include <tuple>
 
 #include "Types.hpp"
 #include "Context.hpp"
@@ -103,6 +104,80 @@ public:
   bool process_nh_vars () const { return m_process_nh_vars; }
 };
 
+// Generate a random state at time level np1 that is valid input for the whole HV functor
+static void generate_hv_state (const int np1, const bool hydrostatic, const unsigned int seed,
+                               std::mt19937_64& engine, const HybridVCoord& hvcoord,
+                               const ElementsGeometry& geo, ElementsState& state)
+{
+  const int num_elems = state.num_elems();
+
+  // Start from random states
+  state.randomize(seed);
+
+  // The HV functor as a whole is more delicate than biharmonic_wk.
+  // In particular, the EOS is used a couple of times. This means
+  // that inputs *must* satisfy some minimum requirements, like
+  // dp>0, vtheta>0, and d(phi)>0. This is very unlikely with random
+  // inputs coming from state.randomize(seed), so we generate data
+  // as "realistic" as possible, and perturb it.
+  // This computation mimics that of
+  // src/theta-l/share/element_ops.F90:initialize_reference_states().
+  using PDF = std::uniform_real_distribution<Real>;
+  ExecViewManaged<Scalar*[NP][NP][NUM_LEV_P]> perturb("",num_elems);
+
+  static constexpr Real T1 =
+    PhysicalConstants::Tref_lapse_rate*PhysicalConstants::Tref*PhysicalConstants::cp/PhysicalConstants::g;
+  static constexpr Real T0 = PhysicalConstants::Tref-T1;
+
+  constexpr Real noise_lvl = 0.05;
+  genRandArray(perturb,engine,PDF(-noise_lvl,noise_lvl));
+  EquationOfState eos;
+  eos.init(hydrostatic,hvcoord);
+
+  ElementOps elem_ops;
+  elem_ops.init(hvcoord);
+
+  ExecViewManaged<Scalar[NUM_LEV]> buf_m("");
+  ExecViewManaged<Scalar[NUM_LEV_P]> buf_i("");
+  Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace>(num_elems),
+                       KOKKOS_LAMBDA(const TeamMember& team){
+    KernelVariables kv(team);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
+                         [&](const int idx){
+      const int igp = idx / NP;
+      const int jgp = idx % NP;
+
+      auto noise = Homme::subview(perturb,kv.ie,igp,jgp);
+      auto dp = Homme::subview(state.m_dp3d,kv.ie,np1,igp,jgp);
+      auto theta = Homme::subview(state.m_vtheta_dp,kv.ie,np1,igp,jgp);
+      auto phi = Homme::subview(state.m_phinh_i,kv.ie,np1,igp,jgp);
+
+      // First, compute dp = dp_ref+noise
+      hvcoord.compute_dp_ref(kv,state.m_ps_v(kv.ie,np1,igp,jgp),dp);
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
+                           [&](const int ilev){
+        dp(ilev) *= 1.0 + noise(ilev);
+      });
+      // Compute pressure
+      elem_ops.compute_hydrostatic_p(kv,dp,buf_i,buf_m);
+
+      // Compute vtheta_dp = theta_ref*dp, where
+      // theta_ref = T0/exner + T1, exner = (p/p0)^k
+      // theta_ref mimics computation in src/theta-l/share/element_ops.F90:set_theta_ref()
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
+                           [&](const int ilev){
+        theta(ilev) = pow(buf_m(ilev)/PhysicalConstants::p0,PhysicalConstants::kappa);
+        theta(ilev) = T0/theta(ilev) + T1;
+        theta(ilev) *= dp(ilev);
+      });
+
+      // Compute phi
+      eos.compute_phi_i(kv,geo.m_phis(kv.ie,igp,jgp),
+                        theta,buf_m,phi);
+    });
+  });
+}
+
 TEST_CASE("hvf", "biharmonic") {
 
   // Catch runs these blocks of code multiple times, namely once per each
@@ -474,70 +549,7 @@ TEST_CASE("hvf", "biharmonic") {
         hvf.set_timestep_data(np1,dt,eta_ave_w);
 
         // Generate random states
-        state.randomize(seed);
-
-        // The HV functor as a whole is more delicate than biharmonic_wk.
-        // In particular, the EOS is used a couple of times. This means
-        // that inputs *must* satisfy some minimum requirements, like
-        // dp>0, vtheta>0, and d(phi)>0. This is very unlikely with random
-        // inputs coming from state.randomize(seed), so we generate data
-        // as "realistic" as possible, and perturb it.
-        // This computation mimics that of
-        // src/theta-l/share/element_ops.F90:initialize_reference_states().
-        using PDF = std::uniform_real_distribution<Real>;
-        ExecViewManaged<Scalar*[NP][NP][NUM_LEV_P]> perturb("",num_elems);
-
-        static constexpr Real T1 =
-          PhysicalConstants::Tref_lapse_rate*PhysicalConstants::Tref*PhysicalConstants::cp/PhysicalConstants::g;
-        static constexpr Real T0 = PhysicalConstants::Tref-T1;
-
-        constexpr Real noise_lvl = 0.05;
-        genRandArray(perturb,engine,PDF(-noise_lvl,noise_lvl));
-        EquationOfState eos;
-        eos.init(hydrostatic,hvcoord);
-
-        ElementOps elem_ops;
-        elem_ops.init(hvcoord);
-
-        ExecViewManaged<Scalar[NUM_LEV]> buf_m("");
-        ExecViewManaged<Scalar[NUM_LEV_P]> buf_i("");
-        Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace>(num_elems),
-                             KOKKOS_LAMBDA(const TeamMember& team){
-          KernelVariables kv(team);
-          Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
-                               [&](const int idx){
-            const int igp = idx / NP;
-            const int jgp = idx % NP;
-
-            auto noise = Homme::subview(perturb,kv.ie,igp,jgp);
-            auto dp = Homme::subview(state.m_dp3d,kv.ie,np1,igp,jgp);
-            auto theta = Homme::subview(state.m_vtheta_dp,kv.ie,np1,igp,jgp);
-            auto phi = Homme::subview(state.m_phinh_i,kv.ie,np1,igp,jgp);
-
-            // First, compute dp = dp_ref+noise
-            hvcoord.compute_dp_ref(kv,state.m_ps_v(kv.ie,np1,igp,jgp),dp);
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
-                                 [&](const int ilev){
-              dp(ilev) *= 1.0 + noise(ilev);
-            });
-            // Compute pressure
-            elem_ops.compute_hydrostatic_p(kv,dp,buf_i,buf_m);
-
-            // Compute vtheta_dp = theta_ref*dp, where
-            // theta_ref = T0/exner + T1, exner = (p/p0)^k
-            // theta_ref mimics computation in src/theta-l/share/element_ops.F90:set_theta_ref()
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
-                                 [&](const int ilev){
-              theta(ilev) = pow(buf_m(ilev)/PhysicalConstants::p0,PhysicalConstants::kappa);
-              theta(ilev) = T0/theta(ilev) + T1;
-              theta(ilev) *= dp(ilev);
-            });
-
-            // Compute phi
-            eos.compute_phi_i(kv,geo.m_phis(kv.ie,igp,jgp),
-                              theta,buf_m,phi);
-          });
-        });
+        generate_hv_state(np1,hydrostatic,seed,engine,hvcoord,geo,state);
 
         // The be needs to be inited after the hydrostatic option has been set
         hvf.init_boundary_exchanges();
@@ -680,6 +692,102 @@ TEST_CASE("hvf", "biharmonic") {
     }
   }
 
+  SECTION ("hv_overlap_exchange") {
+    // Overlapping the boundary exchanges with the interior elements must not change the results
+    std::cout << "Hypervis overlap exchange test:\n";
+
+    using ScalarStateF90    = HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][NP][NP]>;
+    using ScalarStateIntF90 = HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_INTERFACE_LEV][NP][NP]>;
+    using VectorStateF90    = HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][2][NP][NP]>;
+
+    for (const bool hydrostatic : {true, false}) {
+      std::cout << " -> " << (hydrostatic ? "hydrostatic" : "non-hydrostatic") << "\n";
+
+      for (Real hv_scaling : {0.0, 1.2345}) {
+        std::cout << "   -> hypervis scaling = " << hv_scaling << "\n";
+        params.theta_hydrostatic_mode = hydrostatic;
+        params.hypervis_scaling = hv_scaling;
+        params.nu_ratio1 = params.nu_div / params.nu;
+        params.nu_ratio2 = 1.0;
+
+        const Real dt = RPDF(1e-5,1e-3)(engine);
+        const Real eta_ave_w = 1.0;
+        int  np1 = IPDF(0,2)(engine);
+        // Sync np1 across ranks. If they are not synced, we may get stuck in an mpi wait
+        MPI_Bcast(&np1,1,MPI_INT,0,c.get<Comm>().mpi_comm());
+
+        // Both runs start from this state
+        generate_hv_state(np1,hydrostatic,seed,engine,hvcoord,geo,state);
+        decltype(state.m_v)         v0("",num_elems);
+        decltype(state.m_w_i)       w0("",num_elems);
+        decltype(state.m_vtheta_dp) vtheta0("",num_elems);
+        decltype(state.m_phinh_i)   phinh0("",num_elems);
+        decltype(state.m_dp3d)      dp0("",num_elems);
+        decltype(state.m_ps_v)      ps0("",num_elems);
+        Kokkos::deep_copy(v0,state.m_v);
+        Kokkos::deep_copy(w0,state.m_w_i);
+        Kokkos::deep_copy(vtheta0,state.m_vtheta_dp);
+        Kokkos::deep_copy(phinh0,state.m_phinh_i);
+        Kokkos::deep_copy(dp0,state.m_dp3d);
+        Kokkos::deep_copy(ps0,state.m_ps_v);
+
+        // Run the HV functor from the saved state, and return the updated state
+        auto run = [&](const bool overlap) {
+          params.hv_overlap_exchange = overlap;
+          Kokkos::deep_copy(state.m_v,v0);
+          Kokkos::deep_copy(state.m_w_i,w0);
+          Kokkos::deep_copy(state.m_vtheta_dp,vtheta0);
+          Kokkos::deep_copy(state.m_phinh_i,phinh0);
+          Kokkos::deep_copy(state.m_dp3d,dp0);
+          Kokkos::deep_copy(state.m_ps_v,ps0);
+
+          HVFTester hvf(params,geo,state,derived);
+
+          FunctorsBuffersManager fbm;
+          fbm.request_size( hvf.requested_buffer_size() );
+          fbm.allocate();
+          hvf.init_buffers(fbm);
+          hvf.init_boundary_exchanges();
+          hvf.set_hv_data(hv_scaling,params.nu_ratio1,params.nu_ratio2);
+
+          hvf.run(np1,dt,eta_ave_w);
+
+          ScalarStateF90    dp3d("",num_elems);
+          ScalarStateF90    vtheta_dp("",num_elems);
+          ScalarStateIntF90 w_i("",num_elems);
+          ScalarStateIntF90 phinh_i("",num_elems);
+          VectorStateF90    v("",num_elems);
+          sync_to_host(state.m_dp3d, dp3d);
+          sync_to_host(state.m_vtheta_dp, vtheta_dp);
+          sync_to_host(state.m_w_i, w_i);
+          sync_to_host(state.m_phinh_i, phinh_i);
+          sync_to_host(state.m_v, v);
+          return std::make_tuple(dp3d,vtheta_dp,w_i,phinh_i,v);
+        };
+
+        const auto ref = run(false);
+        const auto tst = run(true);
+
+        auto check = [&](const Real* ref_data, const Real* tst_data, const int size, const std::string& name) {
+          for (int i=0; i<size; ++i) {
+            if (ref_data[i]!=tst_data[i]) {
+              printf("%s[%d]:\n",name.c_str(),i);
+              printf("  no overlap: %3.40f\n",ref_data[i]);
+              printf("  overlap   : %3.40f\n",tst_data[i]);
+            }
+            REQUIRE(ref_data[i]==tst_data[i]);
+          }
+        };
+        check(std::get<0>(ref).data(),std::get<0>(tst).data(),std::get<0>(ref).size(),"dp3d");
+        check(std::get<1>(ref).data(),std::get<1>(tst).data(),std::get<1>(ref).size(),"vtheta_dp");
+        check(std::get<2>(ref).data(),std::get<2>(tst).data(),std::get<2>(ref).size(),"w_i");
+        check(std::get<3>(ref).data(),std::get<3>(tst).data(),std::get<3>(ref).size(),"phinh_i");
+        check(std::get<4>(ref).data(),std::get<4>(tst).data(),std::get<4>(ref).size(),"v");
+      }
+    }
+    params.hv_overlap_exchange = false;
+  }
+
   // The tester.cpp file (where the 'main' is), inits the comm in
   // the context. When there are multiple test_cases/sections, we
   // need to make sure the context is returned in the same status